@@ -21,6 +21,7 @@
 
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* Begin Error Codes */
@@ -29,6 +30,8 @@
 
 // System level errors.
 #define UIOHOOK_ERROR_OUT_OF_MEMORY              0x02
+#define UIOHOOK_ERROR_BACKEND_UNAVAILABLE        0x03
+#define UIOHOOK_ERROR_THREAD_CREATE              0x10
 
 // Unix specific errors.
 #define UIOHOOK_ERROR_X_OPEN_DISPLAY             0x20
@@ -74,9 +77,27 @@ typedef enum _event_type {
     EVENT_MOUSE_RELEASED,
     EVENT_MOUSE_MOVED,
     EVENT_MOUSE_DRAGGED,
-    EVENT_MOUSE_WHEEL
+    EVENT_MOUSE_WHEEL,
+    EVENT_KEYBOARD_LAYOUT_CHANGED
 } event_type;
 
+/* Event classes that can be selected with hook_set_event_mask(). */
+#define EVENT_MASK_KEYBOARD                      (1 << 0)
+#define EVENT_MASK_MOUSE_BUTTON                  (1 << 1)    // Includes wheel events
+#define EVENT_MASK_MOUSE_MOTION                  (1 << 2)
+#define EVENT_MASK_ALL                           (EVENT_MASK_KEYBOARD | EVENT_MASK_MOUSE_BUTTON | EVENT_MASK_MOUSE_MOTION)
+
+/* Capture backends that can be selected with hook_set_backend().  XInput2
+ * raw events are not generated for key auto repeat, so unlike XRecord that
+ * backend only reports the first EVENT_KEY_PRESSED of a held key.
+ */
+typedef enum _backend_type {
+    BACKEND_AUTO = 0,
+    BACKEND_XRECORD,
+    BACKEND_XINPUT2,
+    BACKEND_EVDEV
+} backend_type;
+
 typedef struct _screen_data {
     uint8_t number;
     int16_t x;
@@ -124,9 +145,38 @@ typedef struct _uiohook_event {
         mouse_event_data mouse;
         mouse_wheel_event_data wheel;
     } data;
+    uint64_t receive_time;    // CLOCK_MONOTONIC nanoseconds when read, 0 on Windows and macOS
 } uiohook_event;
 
+/* Log2 bucketed histogram of durations in nanoseconds.  Bucket 0 counts
+ * values below 2 ns, bucket i counts values in [2^i, 2^(i + 1)) and the last
+ * bucket also counts everything above it.
+ */
+#define HOOK_STATS_BUCKETS                       32
+
+typedef struct _hook_histogram {
+    uint64_t count;
+    uint64_t total;
+    uint64_t max;
+    uint64_t buckets[HOOK_STATS_BUCKETS];
+} hook_histogram;
+
+typedef struct _hook_stats {
+    // Dispatched events indexed by event_type.
+    uint64_t events[EVENT_KEYBOARD_LAYOUT_CHANGED + 1];
+
+    // Time from the input being timestamped by the system to the hook receiving it.
+    hook_histogram receive;
+
+    // Time spent turning native input into events, excluding the dispatcher.
+    hook_histogram translate;
+
+    // Time spent in the dispatch callback.
+    hook_histogram dispatch;
+} hook_stats;
+
 typedef void (*dispatcher_t)(uiohook_event *const);
+typedef void (*batch_dispatcher_t)(uiohook_event *const, size_t);
 /* End Virtual Event Types and Data Structures */
 
 
@@ -417,12 +467,116 @@ extern "C" {
     // Set the logger callback functions.
     UIOHOOK_API void hook_set_logger_proc(logger_t logger_proc);
 
+    // Set the lowest level passed to the logger callback, LOG_LEVEL_DEBUG by
+    // default.  Messages below it are dropped before their arguments are
+    // formatted.
+    UIOHOOK_API void hook_set_log_level(log_level level);
+
     // Send a virtual event back to the system.
     UIOHOOK_API void hook_post_event(uiohook_event * const event);
 
     // Set the event callback function.
     UIOHOOK_API void hook_set_dispatch_proc(dispatcher_t dispatch_proc);
 
+#if !defined(_WIN32) && !defined(__APPLE__)
+    // Set a callback that receives arrays of events, replacing the event
+    // callback while set.  Events are grouped per read from the X server or per
+    // dispatch queue wake up.  Batched events cannot be consumed using reserved.
+    UIOHOOK_API void hook_set_batch_dispatch_proc(batch_dispatcher_t dispatch_proc);
+
+    // Select the event classes to capture, events outside the mask are never
+    // sent by the X server.  Modifier and button masks are only tracked for
+    // the selected classes.  Applies immediately if the hook is running.
+    UIOHOOK_API int hook_set_event_mask(uint16_t mask);
+
+    // Format log messages into a ring of the given number of preallocated
+    // records that a library managed thread writes to the logger callback, or
+    // call the logger callback directly when the size is 0.  Full rings drop
+    // messages instead of blocking.  Do not change while the hook is running.
+    UIOHOOK_API int hook_set_log_buffer_size(size_t size);
+
+    // Write out buffered log messages on the calling thread.
+    UIOHOOK_API void hook_flush_log();
+
+    // Deliver events from a library managed thread using a queue of the given
+    // size, or from the hook thread when the size is 0.  Takes effect at the
+    // next hook_run().  Queued events cannot be consumed using reserved.
+    UIOHOOK_API void hook_set_dispatch_queue_size(size_t size);
+
+    // Record every dispatched event to a compact binary journal at the given
+    // path, replacing the file.  The hook thread only queues a copy of each
+    // event, a library managed thread encodes and writes them.  Fails if a
+    // journal is already being recorded.
+    UIOHOOK_API int hook_start_journal(const char *path);
+
+    // Stop recording and write out the remaining events.  Returns
+    // UIOHOOK_FAILURE if any part of the journal could not be written.
+    UIOHOOK_API int hook_stop_journal();
+
+    // Post events with the original time between them divided by speed, or
+    // as fast as possible when speed is 0.  Events are scheduled against
+    // CLOCK_MONOTONIC, so delays do not accumulate.  Typed, clicked and hook
+    // events are skipped because posting the other events produces them.
+    // Blocks until the last event is posted or hook_stop_replay() is called.
+    UIOHOOK_API int hook_replay_events(uiohook_event *const events, size_t count, double speed);
+
+    // Replay a journal written by hook_start_journal() the same way.
+    UIOHOOK_API int hook_replay_journal(const char *path, double speed);
+
+    // Make a running replay return before its next event.
+    UIOHOOK_API void hook_stop_replay();
+
+    // Insert the event hook without blocking, for use with an existing event
+    // loop.  Call hook_process_pending() each time the descriptor returned by
+    // hook_get_fd() becomes readable and hook_stop() from the same thread to
+    // withdraw the hook.
+    UIOHOOK_API int hook_start();
+
+    // Get the pollable file descriptor of a hook inserted with hook_start(),
+    // or -1 if there is none.
+    UIOHOOK_API int hook_get_fd();
+
+    // Dispatch every event that can be read without blocking.
+    UIOHOOK_API int hook_process_pending();
+
+    // Copy the event counters and latency histograms.  Counters are updated
+    // without locks, so a snapshot taken while the hook runs may be off by
+    // the events in flight.
+    UIOHOOK_API void hook_get_stats(hook_stats *stats);
+
+    // Set all counters and histograms back to zero.  Each thread clears the
+    // counters it updates on its next update, so this is safe to call while
+    // the hook runs.
+    UIOHOOK_API void hook_reset_stats();
+
+    // Convert an event time to CLOCK_MONOTONIC nanoseconds.  X server times
+    // are mapped using the receive times of recent events, so the result is
+    // only as accurate as the delivery of those events.  Returns 0 if there is
+    // no mapping yet.
+    UIOHOOK_API uint64_t hook_time_to_monotonic(uint64_t time);
+
+    // Select the capture backend used by the next hook_run() or hook_start().
+    // BACKEND_AUTO picks the first available backend in the order XInput2,
+    // XRecord, evdev.  Fails with UIOHOOK_ERROR_BACKEND_UNAVAILABLE if the
+    // backend was not built and UIOHOOK_FAILURE while the hook is running.
+    // hook_run() and hook_start() return UIOHOOK_ERROR_BACKEND_UNAVAILABLE if
+    // the selected backend is not supported by the system, such as XInput2
+    // on a server without XInput 2.1.
+    UIOHOOK_API int hook_set_backend(backend_type type);
+
+    // Get the backend that is running, or that would be used if the hook was
+    // started now.  Returns BACKEND_AUTO if no backend is available.
+    UIOHOOK_API backend_type hook_get_backend();
+#endif
+
+#ifdef __linux__
+    // Read input_event records from the given descriptor instead of the
+    // devices under /dev/input.  Only used by the evdev backend and takes
+    // effect at the next hook_run().  Regular files are read until their end.
+    // The descriptor is not closed by the hook; pass -1 to clear the list.
+    UIOHOOK_API int hook_add_input_fd(int fd);
+#endif
+
     // Insert the event hook.
     UIOHOOK_API int hook_run();
 
@@ -0,0 +1,260 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <uiohook.h>
+
+#include "backend.h"
+#include "logger.h"
+
+// Compiled backends, in the order BACKEND_AUTO tries them.
+static const hook_backend *backends[] = {
+    #ifdef USE_X11
+    #ifdef USE_XINPUT2
+    &xinput_backend,
+    #endif
+    &xrecord_backend,
+    #endif
+
+    #ifdef USE_EVDEV
+    &evdev_backend,
+    #endif
+};
+
+#define BACKEND_COUNT (sizeof(backends) / sizeof(backends[0]))
+
+static backend_type selected_type = BACKEND_AUTO;
+
+// Backend of the running hook, claimed by hook_run() or hook_start() and read by hook_stop().
+static const hook_backend *active_backend = NULL;
+static bool is_polled = false;
+
+// Claim the running hook slot for the backend, fails if a hook is already running.
+static bool claim_backend(const hook_backend *backend) {
+    const hook_backend *expected = NULL;
+    if (!__atomic_compare_exchange_n(&active_backend, &expected, backend, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return false;
+    }
+
+    return true;
+}
+
+static const hook_backend * find_backend(backend_type type) {
+    for (size_t i = 0; i < BACKEND_COUNT; i++) {
+        if (type == BACKEND_AUTO ? backends[i]->is_available() : backends[i]->type == type) {
+            return backends[i];
+        }
+    }
+
+    return NULL;
+}
+
+// Get the running backend, or the one the next hook would use.
+static const hook_backend * get_backend() {
+    const hook_backend *backend = __atomic_load_n(&active_backend, __ATOMIC_ACQUIRE);
+    if (backend == NULL) {
+        backend = find_backend(__atomic_load_n(&selected_type, __ATOMIC_RELAXED));
+    }
+
+    if (backend == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: No capture backend is available!\n",
+                __FUNCTION__, __LINE__);
+    }
+
+    return backend;
+}
+
+UIOHOOK_API int hook_set_backend(backend_type type) {
+    if (__atomic_load_n(&active_backend, __ATOMIC_ACQUIRE) != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The backend cannot be changed while the hook is running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    if (type != BACKEND_AUTO && find_backend(type) == NULL) {
+        logger(LOG_LEVEL_WARN, "%s [%u]: Backend %u is not included in this build.\n",
+                __FUNCTION__, __LINE__, type);
+
+        return UIOHOOK_ERROR_BACKEND_UNAVAILABLE;
+    }
+
+    __atomic_store_n(&selected_type, type, __ATOMIC_RELAXED);
+
+    return UIOHOOK_SUCCESS;
+}
+
+UIOHOOK_API backend_type hook_get_backend() {
+    const hook_backend *backend = get_backend();
+    if (backend == NULL) {
+        return BACKEND_AUTO;
+    }
+
+    return backend->type;
+}
+
+UIOHOOK_API int hook_run() {
+    const hook_backend *backend = get_backend();
+    if (backend == NULL) {
+        return UIOHOOK_ERROR_BACKEND_UNAVAILABLE;
+    }
+
+    if (!claim_backend(backend)) {
+        return UIOHOOK_FAILURE;
+    }
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Running backend %u.\n",
+            __FUNCTION__, __LINE__, backend->type);
+
+    int status = backend->run();
+    __atomic_store_n(&active_backend, NULL, __ATOMIC_RELEASE);
+
+    return status;
+}
+
+UIOHOOK_API int hook_start() {
+    const hook_backend *backend = get_backend();
+    if (backend == NULL) {
+        return UIOHOOK_ERROR_BACKEND_UNAVAILABLE;
+    }
+
+    if (!claim_backend(backend)) {
+        return UIOHOOK_FAILURE;
+    }
+
+    // Set before starting so a hook_stop() from the event loop sees it.
+    __atomic_store_n(&is_polled, true, __ATOMIC_RELEASE);
+
+    int status = backend->start();
+    if (status != UIOHOOK_SUCCESS) {
+        __atomic_store_n(&is_polled, false, __ATOMIC_RELAXED);
+        __atomic_store_n(&active_backend, NULL, __ATOMIC_RELEASE);
+    }
+
+    return status;
+}
+
+UIOHOOK_API int hook_get_fd() {
+    const hook_backend *backend = __atomic_load_n(&active_backend, __ATOMIC_ACQUIRE);
+    if (backend == NULL) {
+        return -1;
+    }
+
+    return backend->get_fd();
+}
+
+UIOHOOK_API int hook_process_pending() {
+    const hook_backend *backend = __atomic_load_n(&active_backend, __ATOMIC_ACQUIRE);
+    if (backend == NULL) {
+        return UIOHOOK_FAILURE;
+    }
+
+    return backend->process_pending();
+}
+
+UIOHOOK_API int hook_stop() {
+    const hook_backend *backend = __atomic_load_n(&active_backend, __ATOMIC_ACQUIRE);
+    if (backend == NULL) {
+        return UIOHOOK_FAILURE;
+    }
+
+    // Read before stopping, the slot may be claimed again once the hook is gone.
+    bool is_polled_hook = __atomic_load_n(&is_polled, __ATOMIC_ACQUIRE);
+
+    int status = backend->stop();
+    if (status == UIOHOOK_SUCCESS && is_polled_hook) {
+        // An event loop driven hook is torn down by the stop call itself.
+        __atomic_store_n(&is_polled, false, __ATOMIC_RELAXED);
+        __atomic_store_n(&active_backend, NULL, __ATOMIC_RELEASE);
+    }
+
+    return status;
+}
+
+UIOHOOK_API int hook_set_event_mask(uint16_t mask) {
+    int status = UIOHOOK_SUCCESS;
+
+    // Every backend keeps its own copy so the mask survives a backend change.
+    for (size_t i = 0; i < BACKEND_COUNT; i++) {
+        int backend_status = backends[i]->set_event_mask(mask);
+        if (backend_status != UIOHOOK_SUCCESS) {
+            status = backend_status;
+        }
+    }
+
+    return status;
+}
+
+UIOHOOK_API uint64_t hook_time_to_monotonic(uint64_t time) {
+    const hook_backend *backend = get_backend();
+    if (backend == NULL) {
+        return 0;
+    }
+
+    return backend->time_to_monotonic(time);
+}
+
+UIOHOOK_API void hook_post_event(uiohook_event * const event) {
+    const hook_backend *backend = get_backend();
+    if (backend != NULL) {
+        backend->post_event(event);
+    }
+}
+
+UIOHOOK_API screen_data* hook_create_screen_info(unsigned char *count) {
+    const hook_backend *backend = get_backend();
+    if (backend == NULL) {
+        *count = 0;
+        return NULL;
+    }
+
+    return backend->create_screen_info(count);
+}
+
+UIOHOOK_API long int hook_get_auto_repeat_rate() {
+    const hook_backend *backend = get_backend();
+    return backend != NULL ? backend->get_auto_repeat_rate() : -1;
+}
+
+UIOHOOK_API long int hook_get_auto_repeat_delay() {
+    const hook_backend *backend = get_backend();
+    return backend != NULL ? backend->get_auto_repeat_delay() : -1;
+}
+
+UIOHOOK_API long int hook_get_pointer_acceleration_multiplier() {
+    const hook_backend *backend = get_backend();
+    return backend != NULL ? backend->get_pointer_acceleration_multiplier() : -1;
+}
+
+UIOHOOK_API long int hook_get_pointer_acceleration_threshold() {
+    const hook_backend *backend = get_backend();
+    return backend != NULL ? backend->get_pointer_acceleration_threshold() : -1;
+}
+
+UIOHOOK_API long int hook_get_pointer_sensitivity() {
+    const hook_backend *backend = get_backend();
+    return backend != NULL ? backend->get_pointer_sensitivity() : -1;
+}
+
+UIOHOOK_API long int hook_get_multi_click_time() {
+    const hook_backend *backend = get_backend();
+    return backend != NULL ? backend->get_multi_click_time() : -1;
+}
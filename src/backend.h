@@ -0,0 +1,68 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_backend
+#define _included_backend
+
+#include <stdbool.h>
+#include <uiohook.h>
+
+/* Entry points of a capture backend.  The public hook functions forward to the
+ * backend selected with hook_set_backend(), so a single build can contain
+ * every backend the platform supports.
+ */
+typedef struct _hook_backend {
+    backend_type type;
+
+    // Returns true if the backend can be used on this host.
+    bool (*is_available)();
+
+    int (*run)();
+    int (*stop)();
+    int (*start)();
+    int (*get_fd)();
+    int (*process_pending)();
+    int (*set_event_mask)(uint16_t mask);
+
+    // Converts an event time to monotonic nanoseconds, 0 if there is no mapping.
+    uint64_t (*time_to_monotonic)(uint64_t time);
+
+    void (*post_event)(uiohook_event * const event);
+
+    screen_data * (*create_screen_info)(unsigned char *count);
+    long int (*get_auto_repeat_rate)();
+    long int (*get_auto_repeat_delay)();
+    long int (*get_pointer_acceleration_multiplier)();
+    long int (*get_pointer_acceleration_threshold)();
+    long int (*get_pointer_sensitivity)();
+    long int (*get_multi_click_time)();
+} hook_backend;
+
+#ifdef USE_X11
+extern const hook_backend xrecord_backend;
+
+#ifdef USE_XINPUT2
+extern const hook_backend xinput_backend;
+#endif
+#endif
+
+#ifdef USE_EVDEV
+extern const hook_backend evdev_backend;
+#endif
+
+#endif
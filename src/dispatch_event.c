@@ -0,0 +1,295 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <uiohook.h>
+
+#include "dispatch_event.h"
+#include "hook_stats.h"
+#include "journal.h"
+#include "logger.h"
+
+/* Bounded single-producer, single-consumer ring used to hand events from the
+ * hook thread to the dispatch thread.  The hook thread only ever writes head
+ * and the dispatch thread only ever writes tail, so neither side needs a lock
+ * to move events.  The mutex and condition are only used to park the
+ * dispatch thread while the ring is empty.
+ */
+typedef struct _dispatch_queue {
+    uiohook_event *events;
+    size_t mask;
+    size_t head;
+    size_t tail;
+    bool is_running;
+    bool is_waiting;
+    bool is_overflow;
+    unsigned long int dropped;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t thread;
+} dispatch_queue;
+static dispatch_queue *queue = NULL;
+
+// Requested queue capacity, zero for synchronous dispatch.
+static size_t queue_size = 0;
+
+// Events held for the batch callback until the end of the current drain.
+#define BATCH_SIZE_MAX 64
+static uiohook_event batch[BATCH_SIZE_MAX];
+static size_t batch_count = 0;
+
+// Event dispatch callbacks.
+static dispatcher_t dispatcher = NULL;
+static batch_dispatcher_t batch_dispatcher = NULL;
+
+UIOHOOK_API void hook_set_dispatch_proc(dispatcher_t dispatch_proc) {
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Setting new dispatch callback to %#p.\n",
+            __FUNCTION__, __LINE__, dispatch_proc);
+
+    dispatcher = dispatch_proc;
+}
+
+UIOHOOK_API void hook_set_batch_dispatch_proc(batch_dispatcher_t dispatch_proc) {
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Setting new batch dispatch callback to %#p.\n",
+            __FUNCTION__, __LINE__, dispatch_proc);
+
+    batch_dispatcher = dispatch_proc;
+}
+
+UIOHOOK_API void hook_set_dispatch_queue_size(size_t size) {
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Setting dispatch queue size to %zu.\n",
+            __FUNCTION__, __LINE__, size);
+
+    queue_size = size;
+}
+
+// Send out an event if a dispatcher was set.
+static inline void deliver_event(uiohook_event *const event) {
+    if (dispatcher != NULL) {
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Dispatching event type %u.\n",
+                __FUNCTION__, __LINE__, event->type);
+
+        uint64_t start = stats_now();
+        dispatcher(event);
+        stats_record_dispatch(stats_now() - start);
+    } else {
+        logger(LOG_LEVEL_WARN, "%s [%u]: No dispatch callback set!\n",
+                __FUNCTION__, __LINE__);
+    }
+}
+
+// Send out a contiguous run of events, preferring the batch callback if set.
+static inline void deliver_batch(uiohook_event *const events, size_t count) {
+    batch_dispatcher_t batch_proc = batch_dispatcher;
+    if (batch_proc != NULL) {
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Dispatching batch of %zu events.\n",
+                __FUNCTION__, __LINE__, count);
+
+        uint64_t start = stats_now();
+        batch_proc(events, count);
+        stats_record_dispatch(stats_now() - start);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            deliver_event(&events[i]);
+        }
+    }
+}
+
+// Copy an event into the queue, the hook thread never waits for the consumer.
+static inline void enqueue_event(uiohook_event *const event) {
+    size_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail > queue->mask) {
+        // Only report the first event dropped by each overflow.
+        if (!queue->is_overflow) {
+            logger(LOG_LEVEL_WARN, "%s [%u]: Dispatch queue is full, dropping events!\n",
+                    __FUNCTION__, __LINE__);
+
+            queue->is_overflow = true;
+        }
+
+        queue->dropped++;
+        return;
+    }
+    queue->is_overflow = false;
+
+    queue->events[head & queue->mask] = *event;
+
+    // Sequentially consistent so this store and the load of is_waiting cannot be
+    // reordered against the consumer's store of is_waiting and load of head.
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&queue->is_waiting, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&queue->mutex);
+        pthread_cond_signal(&queue->cond);
+        pthread_mutex_unlock(&queue->mutex);
+    }
+}
+
+void dispatch_event(uiohook_event *const event) {
+    stats_record_event(event->type);
+    journal_record_event(event);
+
+    if (queue != NULL) {
+        enqueue_event(event);
+    } else if (batch_dispatcher != NULL) {
+        batch[batch_count++] = *event;
+        if (batch_count == BATCH_SIZE_MAX) {
+            flush_dispatch_batch();
+        }
+    } else {
+        deliver_event(event);
+    }
+
+    // Time spent in a synchronous callback is not part of the translation.
+    stats_resume_translation();
+}
+
+void flush_dispatch_batch() {
+    if (batch_count > 0) {
+        deliver_batch(batch, batch_count);
+        batch_count = 0;
+    }
+}
+
+static void *dispatch_thread_proc(void *arg) {
+    size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+    while (true) {
+        size_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+        if (head != tail) {
+            // Deliver directly from the ring, slots are not reused until tail moves
+            // past them.  Everything available is delivered as one batch unless it
+            // wraps around the end of the ring.
+            while (tail != head) {
+                size_t index = tail & queue->mask;
+                size_t count = head - tail;
+                if (count > queue->mask + 1 - index) {
+                    count = queue->mask + 1 - index;
+                }
+
+                deliver_batch(&queue->events[index], count);
+                tail += count;
+
+                __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+            }
+        } else if (!__atomic_load_n(&queue->is_running, __ATOMIC_SEQ_CST)) {
+            // Stopped, exit once everything produced before the stop is delivered.
+            if (__atomic_load_n(&queue->head, __ATOMIC_SEQ_CST) == tail) {
+                break;
+            }
+        } else {
+            // Park until the hook thread produces more events.
+            pthread_mutex_lock(&queue->mutex);
+            __atomic_store_n(&queue->is_waiting, true, __ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&queue->head, __ATOMIC_SEQ_CST) == tail
+                    && __atomic_load_n(&queue->is_running, __ATOMIC_SEQ_CST)) {
+                pthread_cond_wait(&queue->cond, &queue->mutex);
+            }
+            __atomic_store_n(&queue->is_waiting, false, __ATOMIC_SEQ_CST);
+            pthread_mutex_unlock(&queue->mutex);
+        }
+    }
+
+    return NULL;
+}
+
+int start_dispatch_queue() {
+    if (queue_size == 0) {
+        return UIOHOOK_SUCCESS;
+    }
+
+    // Round the capacity up to a power of two so the index can be masked.
+    size_t capacity = 1;
+    while (capacity < queue_size && capacity < SIZE_MAX / 2) {
+        capacity <<= 1;
+    }
+
+    queue = malloc(sizeof(dispatch_queue));
+    if (queue == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for dispatch queue!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    queue->events = malloc(sizeof(uiohook_event) * capacity);
+    if (queue->events == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for %zu queued events!\n",
+                __FUNCTION__, __LINE__, capacity);
+
+        free(queue);
+        queue = NULL;
+
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    queue->mask = capacity - 1;
+    queue->head = 0;
+    queue->tail = 0;
+    queue->is_running = true;
+    queue->is_waiting = false;
+    queue->is_overflow = false;
+    queue->dropped = 0;
+    pthread_mutex_init(&queue->mutex, NULL);
+    pthread_cond_init(&queue->cond, NULL);
+
+    if (pthread_create(&queue->thread, NULL, dispatch_thread_proc, NULL) != 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create dispatch thread!\n",
+                __FUNCTION__, __LINE__);
+
+        pthread_cond_destroy(&queue->cond);
+        pthread_mutex_destroy(&queue->mutex);
+        free(queue->events);
+        free(queue);
+        queue = NULL;
+
+        return UIOHOOK_ERROR_THREAD_CREATE;
+    }
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Started dispatch thread with a %zu event queue.\n",
+            __FUNCTION__, __LINE__, capacity);
+
+    return UIOHOOK_SUCCESS;
+}
+
+void stop_dispatch_queue() {
+    if (queue != NULL) {
+        pthread_mutex_lock(&queue->mutex);
+        __atomic_store_n(&queue->is_running, false, __ATOMIC_SEQ_CST);
+        pthread_cond_signal(&queue->cond);
+        pthread_mutex_unlock(&queue->mutex);
+
+        pthread_join(queue->thread, NULL);
+
+        if (queue->dropped > 0) {
+            logger(LOG_LEVEL_WARN, "%s [%u]: Dropped %lu events due to dispatch queue overflow.\n",
+                    __FUNCTION__, __LINE__, queue->dropped);
+        }
+
+        pthread_cond_destroy(&queue->cond);
+        pthread_mutex_destroy(&queue->mutex);
+        free(queue->events);
+        free(queue);
+        queue = NULL;
+    }
+}
@@ -0,0 +1,46 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_dispatch_event
+#define _included_dispatch_event
+
+#include <uiohook.h>
+
+/* Send an event to the dispatch callback.  If a dispatch queue is running the
+ * event is copied into the queue and delivered by the dispatch thread,
+ * otherwise the callback is invoked on the calling thread.
+ */
+extern void dispatch_event(uiohook_event *const event);
+
+/* Deliver any events held for the batch callback.  Called once the hook has
+ * processed everything currently available from the X server.
+ */
+extern void flush_dispatch_batch();
+
+/* Start the dispatch thread if a queue size was set with
+ * hook_set_dispatch_queue_size().  Events are dispatched synchronously when no
+ * queue was requested.
+ */
+extern int start_dispatch_queue();
+
+/* Wait for the dispatch thread to deliver all queued events, then release the
+ * queue created by start_dispatch_queue().
+ */
+extern void stop_dispatch_queue();
+
+#endif
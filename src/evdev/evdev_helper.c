@@ -0,0 +1,359 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <uiohook.h>
+
+#include "evdev_helper.h"
+
+/* The following table is based on QEMU's x_keymap.c, under the following
+ * terms:
+ *
+ * Copyright (C) 2003 Fabrice Bellard <fabrice@bellard.org>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This table is generated based off the evdev -> scancode mapping above
+ * and the keycode mappings in the following files:
+ *    /usr/include/linux/input.h
+ *    /usr/share/X11/xkb/keycodes/evdev
+ *
+ * NOTE This table only works for Linux.
+ */
+static const uint16_t evdev_scancode_table[][2] = {
+    /* idx        { keycode,                scancode                },     idx  evdev code */
+    /*   0 */    { VC_UNDEFINED,            0x00                    }, /* 0x00    KEY_RESERVED */
+    /*   1 */    { VC_UNDEFINED,            0x09                    }, /* 0x01    KEY_ESC */
+    /*   2 */    { VC_UNDEFINED,            0x0A                    }, /* 0x02    KEY_1 */
+    /*   3 */    { VC_UNDEFINED,            0x0B                    }, /* 0x03    KEY_2 */
+    /*   4 */    { VC_UNDEFINED,            0x0C                    }, /* 0x04    KEY_3 */
+    /*   5 */    { VC_UNDEFINED,            0x0D                    }, /* 0x05    KEY_4 */
+    /*   6 */    { VC_UNDEFINED,            0x0E                    }, /* 0x06    KEY_5 */
+    /*   7 */    { VC_UNDEFINED,            0x0F                    }, /* 0x07    KEY_6 */
+    /*   8 */    { VC_UNDEFINED,            0x10                    }, /* 0x08    KEY_7 */
+    /*   9 */    { VC_ESCAPE,               0x11                    }, /* 0x09    KEY_8 */
+    /*  10 */    { VC_1,                    0x12                    }, /* 0x0A    KEY_9 */
+    /*  11 */    { VC_2,                    0x13                    }, /* 0x0B    KEY_0 */
+    /*  12 */    { VC_3,                    0x14                    }, /* 0x0C    KEY_MINUS */
+    /*  13 */    { VC_4,                    0x15                    }, /* 0x0D    KEY_EQUAL */
+    /*  14 */    { VC_5,                    0x16                    }, /* 0x0E    KEY_BACKSPACE */
+    /*  15 */    { VC_6,                    0x17                    }, /* 0x0F    KEY_TAB */
+    /*  16 */    { VC_7,                    0x18                    }, /* 0x10    KEY_Q */
+    /*  17 */    { VC_8,                    0x19                    }, /* 0x11    KEY_W */
+    /*  18 */    { VC_9,                    0x1A                    }, /* 0x12    KEY_E */
+    /*  19 */    { VC_0,                    0x1B                    }, /* 0x13    KEY_T */
+    /*  20 */    { VC_MINUS,                0x1C                    }, /* 0x14    KEY_R */
+    /*  21 */    { VC_EQUALS,               0x1D                    }, /* 0x15    KEY_Y */
+    /*  22 */    { VC_BACKSPACE,            0x1E                    }, /* 0x16    KEY_U */
+    /*  23 */    { VC_TAB,                  0x1F                    }, /* 0x17    KEY_I */
+    /*  24 */    { VC_Q,                    0x20                    }, /* 0x18    KEY_O */
+    /*  25 */    { VC_W,                    0x21                    }, /* 0x19    KEY_P */
+    /*  26 */    { VC_E,                    0x22                    }, /* 0x1A    KEY_LEFTBRACE */
+    /*  27 */    { VC_R,                    0x23                    }, /* 0x1B    KEY_RIGHTBRACE */
+    /*  28 */    { VC_T,                    0x24                    }, /* 0x1C    KEY_ENTER */
+    /*  29 */    { VC_Y,                    0x25                    }, /* 0x1D    KEY_LEFTCTRL */
+    /*  30 */    { VC_U,                    0x26                    }, /* 0x1E    KEY_A */
+    /*  31 */    { VC_I,                    0x27                    }, /* 0x1F    KEY_S */
+    /*  32 */    { VC_O,                    0x28                    }, /* 0x20    KEY_D */
+    /*  33 */    { VC_P,                    0x29                    }, /* 0x21    KEY_F */
+    /*  34 */    { VC_OPEN_BRACKET,         0x2A                    }, /* 0x22    KEY_G */
+    /*  35 */    { VC_CLOSE_BRACKET,        0x2B                    }, /* 0x23    KEY_H */
+    /*  36 */    { VC_ENTER,                0x2C                    }, /* 0x24    KEY_J */
+    /*  37 */    { VC_CONTROL_L,            0x2D                    }, /* 0x25    KEY_K */
+    /*  38 */    { VC_A,                    0x2E                    }, /* 0x26    KEY_L */
+    /*  39 */    { VC_S,                    0x2F                    }, /* 0x27    KEY_SEMICOLON */
+    /*  40 */    { VC_D,                    0x30                    }, /* 0x28    KEY_APOSTROPHE */
+    /*  41 */    { VC_F,                    0x31                    }, /* 0x29    KEY_GRAVE */
+    /*  42 */    { VC_G,                    0x32                    }, /* 0x2A    KEY_LEFTSHIFT */
+    /*  43 */    { VC_H,                    0x33                    }, /* 0x2B    KEY_BACKSLASH */
+    /*  44 */    { VC_J,                    0x34                    }, /* 0x2C    KEY_Z */
+    /*  45 */    { VC_K,                    0x35                    }, /* 0x2D    KEY_X */
+    /*  46 */    { VC_L,                    0x36                    }, /* 0x2E    KEY_C */
+    /*  47 */    { VC_SEMICOLON,            0x37                    }, /* 0x2F    KEY_V */
+    /*  48 */    { VC_QUOTE,                0x38                    }, /* 0x30    KEY_B */
+    /*  49 */    { VC_BACKQUOTE,            0x39                    }, /* 0x31    KEY_N */
+    /*  50 */    { VC_SHIFT_L,              0x3A                    }, /* 0x32    KEY_M */
+    /*  51 */    { VC_BACK_SLASH,           0x3B                    }, /* 0x33    KEY_COMMA */
+    /*  52 */    { VC_Z,                    0x3C                    }, /* 0x34    KEY_DOT */
+    /*  53 */    { VC_X,                    0x3D                    }, /* 0x35    KEY_SLASH */
+    /*  54 */    { VC_C,                    0x3E                    }, /* 0x36    KEY_RIGHTSHIFT */
+    /*  55 */    { VC_V,                    0x3F                    }, /* 0x37    KEY_KPASTERISK */
+    /*  56 */    { VC_B,                    0x40                    }, /* 0x38    KEY_LEFTALT */
+    /*  57 */    { VC_N,                    0x41                    }, /* 0x39    KEY_SPACE */
+    /*  58 */    { VC_M,                    0x42                    }, /* 0x3A    KEY_CAPSLOCK */
+    /*  59 */    { VC_COMMA,                0x43                    }, /* 0x3B    KEY_F1 */
+    /*  60 */    { VC_PERIOD,               0x44                    }, /* 0x3C    KEY_F2 */
+    /*  61 */    { VC_SLASH,                0x45                    }, /* 0x3D    KEY_F3 */
+    /*  62 */    { VC_SHIFT_R,              0x46                    }, /* 0x3E    KEY_F4 */
+    /*  63 */    { VC_KP_MULTIPLY,          0x47                    }, /* 0x3F    KEY_F5 */
+    /*  64 */    { VC_ALT_L,                0x48                    }, /* 0x40    KEY_F6 */
+    /*  65 */    { VC_SPACE,                0x49                    }, /* 0x41    KEY_F7 */
+    /*  66 */    { VC_CAPS_LOCK,            0x4A                    }, /* 0x42    KEY_F8 */
+    /*  67 */    { VC_F1,                   0x4B                    }, /* 0x43    KEY_F9 */
+    /*  68 */    { VC_F2,                   0x4C                    }, /* 0x44    KEY_F10 */
+    /*  69 */    { VC_F3,                   0x4D                    }, /* 0x45    KEY_NUMLOCK */
+    /*  70 */    { VC_F4,                   0x4E                    }, /* 0x46    KEY_SCROLLLOCK */
+    /*  71 */    { VC_F5,                   0x4F                    }, /* 0x47    KEY_KP7 */
+    /*  72 */    { VC_F6,                   0x50                    }, /* 0x48    KEY_KP8 */
+    /*  73 */    { VC_F7,                   0x51                    }, /* 0x49    KEY_KP9 */
+    /*  74 */    { VC_F8,                   0x52                    }, /* 0x4A    KEY_KPMINUS */
+    /*  75 */    { VC_F9,                   0x53                    }, /* 0x4B    KEY_KP4 */
+    /*  76 */    { VC_F10,                  0x54                    }, /* 0x4C    KEY_KP5 */
+    /*  77 */    { VC_NUM_LOCK,             0x55                    }, /* 0x4D    KEY_KP6 */
+    /*  78 */    { VC_SCROLL_LOCK,          0x56                    }, /* 0x4E    KEY_KPPLUS */
+    /*  79 */    { VC_KP_7,                 0x57                    }, /* 0x4F    KEY_KP1 */
+    /*  80 */    { VC_KP_8,                 0x58                    }, /* 0x50    KEY_KP2 */
+    /*  81 */    { VC_KP_9,                 0x59                    }, /* 0x51    KEY_KP3 */
+    /*  82 */    { VC_KP_SUBTRACT,          0x5A                    }, /* 0x52    KEY_KP0 */
+    /*  83 */    { VC_KP_4,                 0x5B                    }, /* 0x53    KEY_KPDOT */
+    /*  84 */    { VC_KP_5,                 0x00                    }, /* 0x54    */
+    /*  85 */    { VC_KP_6,                 0x00                    }, /* 0x55    TODO [KEY_ZENKAKUHANKAKU][0] == [VC_?][1] */
+    /*  86 */    { VC_KP_ADD,               0x00                    }, /* 0x56    TODO [KEY_102ND][0] == [VC_?][1] */
+    /*  87 */    { VC_KP_1,                 0x5F                    }, /* 0x57    KEY_F11 */
+    /*  88 */    { VC_KP_2,                 0x60                    }, /* 0x58    KEY_F12 */
+    /*  89 */    { VC_KP_3,                 0x00                    }, /* 0x59    TODO [KEY_RO][0] == [VC_?][1] */
+    /*  90 */    { VC_KP_0,                 0x00                    }, /* 0x5A */
+    /*  91 */    { VC_KP_SEPARATOR,         0xBF                    }, /* 0x5B    KEY_F13 */
+    /*  92 */    { VC_UNDEFINED,            0xC0                    }, /* 0x5C    KEY_F14 */
+    /*  93 */    { VC_UNDEFINED,            0xC1                    }, /* 0x5D    KEY_F15 */
+    /*  94 */    { VC_UNDEFINED,            0x00                    }, /* 0x5E    TODO [KEY_MUHENKAN][0] == [VC_?][1] */
+    /*  95 */    { VC_F11,                  0x00                    }, /* 0x5F */
+    /*  96 */    { VC_F12,                  0x00                    }, /* 0x60 */
+
+    /* First 97 chars are identical to XFree86!                                */
+
+    /*  97 */    { VC_UNDEFINED,            0x00                    }, /* 0x61 */
+    /*  98 */    { VC_KATAKANA,             0x00                    }, /* 0x62 */
+    /*  99 */    { VC_HIRAGANA,             0xC2                    }, /* 0x63    KEY_F16 */
+    /* 100 */    { VC_KANJI,                0xC3                    }, /* 0x64    KEY_F17 */
+    /* 101 */    { VC_UNDEFINED,            0xC4                    }, /* 0x65    KEY_F18 */
+    /* 102 */    { VC_UNDEFINED,            0xC5                    }, /* 0x66    KEY_F19 */
+    /* 103 */    { VC_KP_COMMA,             0xC6                    }, /* 0x67    KEY_F20 */
+    /* 104 */    { VC_KP_ENTER,             0xC7                    }, /* 0x68    KEY_F21 */
+    /* 105 */    { VC_CONTROL_R,            0xC8                    }, /* 0x69    KEY_F22 */
+    /* 106 */    { VC_KP_DIVIDE,            0xC9                    }, /* 0x6A    KEY_F23 */
+    /* 107 */    { VC_PRINTSCREEN,          0xCA                    }, /* 0x6B    KEY_F24 */
+    /* 108 */    { VC_ALT_R,                0x00                    }, /* 0x6C */
+    /* 109 */    { VC_UNDEFINED,            0x00                    }, /* 0x6D */
+    /* 110 */    { VC_HOME,                 0x00                    }, /* 0x6E */
+    /* 111 */    { VC_UP,                   0x00                    }, /* 0x6F */
+    /* 112 */    { VC_PAGE_UP,              0x62                    }, /* 0x70    KEY_KATAKANA */
+    /* 113 */    { VC_LEFT,                 0x00                    }, /* 0x71 */
+    /* 114 */    { VC_RIGHT,                0x00                    }, /* 0x72 */
+    /* 115 */    { VC_END,                  0x00                    }, /* 0x73    TODO KEY_? = [VC_UNDERSCORE][1] */
+    /* 116 */    { VC_DOWN,                 0x00                    }, /* 0x74    TODO KEY_? = [VC_FURIGANA][1] */
+    /* 117 */    { VC_PAGE_DOWN,            0x00                    }, /* 0x75 */
+    /* 118 */    { VC_INSERT,               0x00                    }, /* 0x76    TODO [KEY_KPPLUSMINUS][0] = [VC_?][1] */
+    /* 119 */    { VC_DELETE,               0x00                    }, /* 0x77 */
+    /* 120 */    { VC_UNDEFINED,            0x00                    }, /* 0x78    TODO [KEY_SCALE][0] = [VC_?][1] */
+    /* 121 */    { VC_VOLUME_MUTE,          0x64                    }, /* 0x79    KEY_HENKAN */
+    /* 122 */    { VC_VOLUME_DOWN,          0x00                    }, /* 0x7A */
+    /* 123 */    { VC_VOLUME_UP,            0x63                    }, /* 0x7B    KEY_HIRAGANA */
+    /* 124 */    { VC_POWER,                0x00                    }, /* 0x7C */
+    /* 125 */    { VC_KP_EQUALS,            0x84                    }, /* 0x7D    KEY_YEN */
+    /* 126 */    { VC_UNDEFINED,            0x67                    }, /* 0x7E    KEY_KPJPCOMMA */
+    /* 127 */    { VC_PAUSE,                0x00                    }, /* 0x7F */
+
+    /*            No Offset                Offset (i & 0x007F) + 128            */
+
+    /* 128 */    { VC_UNDEFINED,            0                       }, /* 0x80 */
+    /* 129 */    { VC_UNDEFINED,            0                       }, /* 0x81 */
+    /* 130 */    { VC_UNDEFINED,            0                       }, /* 0x82 */
+    /* 131 */    { VC_UNDEFINED,            0                       }, /* 0x83 */
+    /* 132 */    { VC_YEN,                  0                       }, /* 0x84 */
+    /* 133 */    { VC_META_L,               0                       }, /* 0x85 */
+    /* 134 */    { VC_META_R,               0                       }, /* 0x86 */
+    /* 135 */    { VC_CONTEXT_MENU,         0                       }, /* 0x87 */
+    /* 136 */    { VC_SUN_STOP,             0                       }, /* 0x88 */
+    /* 137 */    { VC_SUN_AGAIN,            0                       }, /* 0x89 */
+    /* 138 */    { VC_SUN_PROPS,            0                       }, /* 0x8A */
+    /* 139 */    { VC_SUN_UNDO,             0                       }, /* 0x8B */
+    /* 140 */    { VC_SUN_FRONT,            0                       }, /* 0x8C */
+    /* 141 */    { VC_SUN_COPY,             0x7D                    }, /* 0x8D    KEY_KPEQUAL */
+    /* 142 */    { VC_SUN_OPEN,             0                       }, /* 0x8E */
+    /* 143 */    { VC_SUN_INSERT,           0                       }, /* 0x8F */
+    /* 144 */    { VC_SUN_FIND,             0                       }, /* 0x90 */
+    /* 145 */    { VC_SUN_CUT,              0                       }, /* 0x91 */
+    /* 146 */    { VC_SUN_HELP,             0                       }, /* 0x92 */
+    /* 147 */    { VC_UNDEFINED,            0                       }, /* 0x93 */
+    /* 148 */    { VC_APP_CALCULATOR,       0                       }, /* 0x94 */
+    /* 149 */    { VC_UNDEFINED,            0                       }, /* 0x95 */
+    /* 150 */    { VC_SLEEP,                0                       }, /* 0x96 */
+    /* 151 */    { VC_UNDEFINED,            0                       }, /* 0x97 */
+    /* 152 */    { VC_UNDEFINED,            0                       }, /* 0x98 */
+    /* 153 */    { VC_UNDEFINED,            0                       }, /* 0x99 */
+    /* 154 */    { VC_UNDEFINED,            0                       }, /* 0x9A */
+    /* 155 */    { VC_UNDEFINED,            0                       }, /* 0x9B */
+    /* 156 */    { VC_UNDEFINED,            0x68                    }, /* 0x9C    KEY_KPENTER */
+    /* 157 */    { VC_UNDEFINED,            0x69                    }, /* 0x9D    KEY_RIGHTCTRL */
+    /* 158 */    { VC_UNDEFINED,            0                       }, /* 0x9E */
+    /* 159 */    { VC_UNDEFINED,            0                       }, /* 0x9F */
+    /* 160 */    { VC_UNDEFINED,            0x79                    }, /* 0xA0    KEY_MUTE */
+    /* 161 */    { VC_UNDEFINED,            0x94                    }, /* 0xA1    KEY_CALC */
+    /* 162 */    { VC_UNDEFINED,            0xA7                    }, /* 0xA2    KEY_FORWARD */
+    /* 163 */    { VC_UNDEFINED,            0                       }, /* 0xA3 */
+    /* 164 */    { VC_UNDEFINED,            0                       }, /* 0xA4 */
+    /* 165 */    { VC_UNDEFINED,            0                       }, /* 0xA5 */
+    /* 166 */    { VC_APP_MAIL,             0                       }, /* 0xA6 */
+    /* 167 */    { VC_MEDIA_PLAY,           0                       }, /* 0xA7 */
+    /* 168 */    { VC_UNDEFINED,            0                       }, /* 0xA8 */
+    /* 169 */    { VC_UNDEFINED,            0                       }, /* 0xA9 */
+    /* 170 */    { VC_UNDEFINED,            0                       }, /* 0xAA */
+    /* 171 */    { VC_UNDEFINED,            0                       }, /* 0xAB */
+    /* 172 */    { VC_UNDEFINED,            0                       }, /* 0xAC */
+    /* 173 */    { VC_UNDEFINED,            0                       }, /* 0xAD */
+    /* 174 */    { VC_UNDEFINED,            0x7A                    }, /* 0xAE    KEY_VOLUMEDOWN */
+    /* 175 */    { VC_UNDEFINED,            0                       }, /* 0xAF */
+    /* 176 */    { VC_UNDEFINED,            0x7B                    }, /* 0xB0    KEY_VOLUMEUP */
+    /* 177 */    { VC_UNDEFINED,            0x00                    }, /* 0xB1 */
+    /* 178 */    { VC_UNDEFINED,            0xBA                    }, /* 0xB2    KEY_SCROLLUP */
+    /* 179 */    { VC_UNDEFINED,            0x00                    }, /* 0xB3 */
+    /* 180 */    { VC_UNDEFINED,            0x00                    }, /* 0xB4 */
+    /* 181 */    { VC_UNDEFINED,            0x6A                    }, /* 0xB5    KEY_KPSLASH */
+    /* 182 */    { VC_UNDEFINED,            0x00                    }, /* 0xB6 */
+    /* 183 */    { VC_UNDEFINED,            0x6B                    }, /* 0xB7    KEY_SYSRQ */
+    /* 184 */    { VC_UNDEFINED,            0x6C                    }, /* 0xB8    KEY_RIGHTALT */
+    /* 185 */    { VC_UNDEFINED,            0x00                    }, /* 0xB9 */
+    /* 186 */    { VC_BROWSER_HOME,         0x00                    }, /* 0xBA */
+    /* 187 */    { VC_UNDEFINED,            0x00                    }, /* 0xBB */
+    /* 188 */    { VC_UNDEFINED,            0x00                    }, /* 0xBC */
+    /* 189 */    { VC_UNDEFINED,            0x00                    }, /* 0xBD */
+    /* 190 */    { VC_UNDEFINED,            0x00                    }, /* 0xBE */
+    /* 191 */    { VC_F13,                  0x00                    }, /* 0xBF */
+    /* 192 */    { VC_F14,                  0x00                    }, /* 0xC0 */
+    /* 193 */    { VC_F15,                  0x00                    }, /* 0xC1 */
+    /* 194 */    { VC_F16,                  0x00                    }, /* 0xC2 */
+    /* 195 */    { VC_F17,                  0x00                    }, /* 0xC3 */
+    /* 196 */    { VC_F18,                  0x00                    }, /* 0xC4 */
+    /* 197 */    { VC_F19,                  0x7F                    }, /* 0xC5    KEY_PAUSE */
+    /* 198 */    { VC_F20,                  0x00                    }, /* 0xC6 */
+    /* 199 */    { VC_F21,                  0x6E                    }, /* 0xC7    KEY_HOME */
+    /* 200 */    { VC_F22,                  0x6F                    }, /* 0xC8    KEY_UP */
+    /* 201 */    { VC_F23,                  0x70                    }, /* 0xC9    KEY_PAGEUP */
+    /* 202 */    { VC_F24,                  0x00                    }, /* 0xCA */
+    /* 203 */    { VC_UNDEFINED,            0x71                    }, /* 0xCB    KEY_LEFT */
+    /* 204 */    { VC_UNDEFINED,            0x00                    }, /* 0xCC */
+    /* 205 */    { VC_UNDEFINED,            0x72                    }, /* 0xCD    KEY_RIGHT */
+    /* 206 */    { VC_UNDEFINED,            0x00                    }, /* 0xCE */
+    /* 207 */    { VC_UNDEFINED,            0x73                    }, /* 0xCF    KEY_END */
+    /* 208 */    { VC_UNDEFINED,            0x74                    }, /* 0xD0    KEY_DOWN */
+    /* 209 */    { VC_UNDEFINED,            0x75                    }, /* 0xD1    KEY_PAGEDOWN */
+    /* 210 */    { VC_UNDEFINED,            0x76                    }, /* 0xD2    KEY_INSERT */
+    /* 211 */    { VC_UNDEFINED,            0x77                    }, /* 0xD3    KEY_DELETE */
+    /* 212 */    { VC_UNDEFINED,            0x00                    }, /* 0xD4 */
+    /* 213 */    { VC_UNDEFINED,            0x00                    }, /* 0xD5 */
+    /* 214 */    { VC_UNDEFINED,            0x00                    }, /* 0xD6 */
+    /* 215 */    { VC_UNDEFINED,            0x00                    }, /* 0xD7 */
+    /* 216 */    { VC_UNDEFINED,            0x00                    }, /* 0xD8 */
+    /* 217 */    { VC_UNDEFINED,            0x00                    }, /* 0xD9 */
+    /* 218 */    { VC_UNDEFINED,            0x00                    }, /* 0xDA */
+    /* 219 */    { VC_UNDEFINED,            0x85                    }, /* 0xDB    KEY_LEFTMETA */
+    /* 220 */    { VC_UNDEFINED,            0x86                    }, /* 0xDC    KEY_RIGHTMETA */
+    /* 221 */    { VC_UNDEFINED,            0x87                    }, /* 0xDD    KEY_COMPOSE */
+    /* 222 */    { VC_UNDEFINED,            0x7C                    }, /* 0xDE    KEY_POWER */
+    /* 223 */    { VC_UNDEFINED,            0x96                    }, /* 0xDF    KEY_SLEEP */
+    /* 224 */    { VC_UNDEFINED,            0x00                    }, /* 0xE0 */
+    /* 225 */    { VC_BROWSER_SEARCH,       0x00                    }, /* 0xE1 */
+    /* 226 */    { VC_LESSER_GREATER,       0x00                    }, /* 0xE2 */
+    /* 227 */    { VC_UNDEFINED,            0x00                    }, /* 0xE3 */
+    /* 228 */    { VC_UNDEFINED,            0x00                    }, /* 0xE4 */
+    /* 229 */    { VC_UNDEFINED,            0xE1                    }, /* 0xE5    KEY_SEARCH */
+    /* 230 */    { VC_UNDEFINED,            0x00                    }, /* 0xE6 */
+    /* 231 */    { VC_UNDEFINED,            0x00                    }, /* 0xE7 */
+    /* 232 */    { VC_UNDEFINED,            0x00                    }, /* 0xE8 */
+    /* 233 */    { VC_UNDEFINED,            0x00                    }, /* 0xE9 */
+    /* 234 */    { VC_UNDEFINED,            0x00                    }, /* 0xEA */
+    /* 235 */    { VC_UNDEFINED,            0x00                    }, /* 0xEB */
+    /* 236 */    { VC_UNDEFINED,            0xA6                    }, /* 0xEC    KEY_BACK */
+    /* 237 */    { VC_UNDEFINED,            0x00                    }, /* 0xED */
+    /* 238 */    { VC_UNDEFINED,            0x00                    }, /* 0xEE */
+    /* 239 */    { VC_UNDEFINED,            0x00                    }, /* 0xEF */
+    /* 240 */    { VC_UNDEFINED,            0x00                    }, /* 0xF0 */
+    /* 241 */    { VC_UNDEFINED,            0x00                    }, /* 0xF1 */
+    /* 242 */    { VC_UNDEFINED,            0x00                    }, /* 0xF2 */
+    /* 243 */    { VC_UNDEFINED,            0x00                    }, /* 0xF3 */
+    /* 244 */    { VC_UNDEFINED,            0x8E                    }, /* 0xF4    KEY_OPEN */
+    /* 245 */    { VC_UNDEFINED,            0x92                    }, /* 0xF5    KEY_HELP */
+    /* 246 */    { VC_UNDEFINED,            0x8A                    }, /* 0xF6    KEY_PROPS */
+    /* 247 */    { VC_UNDEFINED,            0x8C                    }, /* 0xF7    KEY_FRONT */
+    /* 248 */    { VC_UNDEFINED,            0x88                    }, /* 0xF8    KEY_STOP */
+    /* 249 */    { VC_UNDEFINED,            0x89                    }, /* 0xF9    KEY_AGAIN */
+    /* 250 */    { VC_UNDEFINED,            0x8B                    }, /* 0xFA    KEY_UNDO */
+    /* 251 */    { VC_UNDEFINED,            0x91                    }, /* 0xFB    KEY_CUT */
+    /* 252 */    { VC_UNDEFINED,            0x8D                    }, /* 0xFC    KEY_COPY */
+    /* 253 */    { VC_UNDEFINED,            0x8F                    }, /* 0xFD    KEY_PASTE */
+    /* 254 */    { VC_UNDEFINED,            0x90                    }, /* 0xFE    KEY_FIND */
+    /* 255 */    { VC_UNDEFINED,            0x00                    }, /* 0xFF */
+};
+
+
+uint16_t evdev_keycode_to_scancode(uint16_t keycode) {
+    uint16_t scancode = VC_UNDEFINED;
+
+    unsigned short evdev_size = sizeof(evdev_scancode_table) / sizeof(evdev_scancode_table[0]);
+
+    // NOTE scancodes < 97 appear to be identical between Evdev and XFree86.
+    if (keycode < evdev_size) {
+        // For scancode < 97, a simple scancode - 8 offest could be applied,
+        // but math is generally slower than memory and we cannot save any
+        // extra space in the lookup table due to binary padding.
+        scancode = evdev_scancode_table[keycode][0];
+    }
+
+    return scancode;
+}
+
+uint16_t evdev_scancode_to_keycode(uint16_t scancode) {
+    uint16_t keycode = 0x0000;
+
+    unsigned short evdev_size = sizeof(evdev_scancode_table) / sizeof(evdev_scancode_table[0]);
+
+    // NOTE scancodes < 97 appear to be identical between Evdev and XFree86.
+    if (scancode < 128) {
+        // For scancode < 97, a simple scancode + 8 offest could be applied,
+        // but math is generally slower than memory and we cannot save any
+        // extra space in the lookup table due to binary padding.
+        keycode = evdev_scancode_table[scancode][1];
+    } else {
+        // Offset is the lower order bits + 128
+        scancode = (scancode & 0x007F) | 0x80;
+
+        if (scancode < evdev_size) {
+            keycode = evdev_scancode_table[scancode][1];
+        }
+    }
+
+    return keycode;
+}
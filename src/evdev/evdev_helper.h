@@ -0,0 +1,36 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_evdev_helper
+#define _included_evdev_helper
+
+#include <stdint.h>
+
+// Key codes reported by the kernel are offset by 8 in the evdev keycode table.
+#define EVDEV_KEYCODE_OFFSET 8
+
+/* Converts an evdev key code, the kernel key code plus EVDEV_KEYCODE_OFFSET as
+ * used by the X11 evdev driver, to the appropriate keyboard scan code.
+ */
+extern uint16_t evdev_keycode_to_scancode(uint16_t keycode);
+
+/* Converts a keyboard scan code to the appropriate evdev key code.
+ */
+extern uint16_t evdev_scancode_to_keycode(uint16_t scancode);
+
+#endif
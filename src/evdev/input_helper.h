@@ -0,0 +1,86 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_input_helper
+#define _included_input_helper
+
+#include <linux/input.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uiohook.h>
+
+#include "evdev_helper.h"
+
+/* The helpers are inline so they can share the X11 backend's names when both
+ * backends are built into the library.
+ */
+
+/* Converts a Linux kernel key code to the appropriate keyboard scan code.
+ */
+static inline uint16_t keycode_to_scancode(uint16_t keycode) {
+    return evdev_keycode_to_scancode(keycode + EVDEV_KEYCODE_OFFSET);
+}
+
+/* Converts a keyboard scan code to the appropriate Linux kernel key code.
+ */
+static inline uint16_t scancode_to_keycode(uint16_t scancode) {
+    uint16_t keycode = evdev_scancode_to_keycode(scancode);
+    if (keycode < EVDEV_KEYCODE_OFFSET) {
+        return 0x0000;
+    }
+
+    return keycode - EVDEV_KEYCODE_OFFSET;
+}
+
+/* Initialize items required for keycode_to_scancode() and
+ * scancode_to_keycode().  The kernel key codes are fixed, so there is nothing
+ * to load, but the call is kept for parity with the other platforms.
+ */
+static inline void load_input_helper() {
+}
+
+/* De-initialize items required for keycode_to_scancode() and
+ * scancode_to_keycode().
+ */
+static inline void unload_input_helper() {
+}
+
+// Backend entry points implemented by post_event.c and system_properties.c.
+extern void evdev_post_event(uiohook_event * const event);
+
+extern screen_data* evdev_create_screen_info(unsigned char *count);
+
+extern long int evdev_get_auto_repeat_rate();
+
+extern long int evdev_get_auto_repeat_delay();
+
+extern long int evdev_get_pointer_acceleration_multiplier();
+
+extern long int evdev_get_pointer_acceleration_threshold();
+
+extern long int evdev_get_pointer_sensitivity();
+
+extern long int evdev_get_multi_click_time();
+
+/* Translate and dispatch prebuilt kernel input events between a hook enabled
+ * and a hook disabled event, exactly as if they were read from a device.  Used
+ * to benchmark the translation path, fails while a hook is running.
+ */
+extern int evdev_process_input_events(struct input_event *const events, size_t count);
+
+#endif
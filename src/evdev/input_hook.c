@@ -0,0 +1,1070 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/input.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <uiohook.h>
+#include <unistd.h>
+
+#include "backend.h"
+#include "dispatch_event.h"
+#include "hook_stats.h"
+#include "input_helper.h"
+#include "logger.h"
+
+// Older kernel headers do not provide the 64-bit time accessors.
+#ifndef input_event_sec
+#define input_event_sec time.tv_sec
+#define input_event_usec time.tv_usec
+#endif
+
+#define EVDEV_DEVICE_DIR "/dev/input"
+#define EVDEV_MAX_SOURCES 64
+#define EVDEV_READ_COUNT 64
+
+// Used when no multi-click interval can be read from the system.
+#define EVDEV_MULTI_CLICK_TIME 200
+
+#define TEST_BIT(bits, bit) ((bits)[(bit) / 8] & (1 << ((bit) % 8)))
+
+typedef struct _evdev_source {
+    int fd;
+    bool is_owned;
+    bool is_file;
+    size_t length;
+    struct input_event partial;
+} evdev_source;
+
+typedef struct _hook_info {
+    int epoll_fd;
+    int stop_fd;
+    // Regular files can not be added to epoll, this stays readable while any remain.
+    int file_fd;
+    bool is_polled;
+    evdev_source *sources[EVDEV_MAX_SOURCES];
+    uint64_t time;
+    uint64_t receive_time;
+    struct _input {
+        uint16_t mask;
+        struct _mouse {
+            bool is_dragged;
+            bool is_moved;
+            int32_t x;
+            int32_t y;
+            struct _click {
+                unsigned short int count;
+                long int time;
+                unsigned short int button;
+            } click;
+        } mouse;
+    } input;
+} hook_info;
+static hook_info *hook;
+
+// Descriptors added with hook_add_input_fd(), read instead of /dev/input.
+static int input_fds[EVDEV_MAX_SOURCES];
+static size_t input_fd_count = 0;
+
+// Event classes requested with hook_set_event_mask().
+static uint16_t event_mask = EVENT_MASK_ALL;
+
+// Virtual event pointer.
+static uiohook_event event;
+
+// Set the native modifier mask for future events.
+static inline void set_modifier_mask(uint16_t mask) {
+    hook->input.mask |= mask;
+}
+
+// Unset the native modifier mask for future events.
+static inline void unset_modifier_mask(uint16_t mask) {
+    hook->input.mask &= ~mask;
+}
+
+// Get the current native modifier mask state.
+static inline uint16_t get_modifiers() {
+    return hook->input.mask;
+}
+
+static inline bool is_event_class_selected(uint16_t event_class) {
+    return (__atomic_load_n(&event_mask, __ATOMIC_RELAXED) & event_class) != 0;
+}
+
+// Get the current time of the clock the device timestamps are taken from.
+static uint64_t get_event_time() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Initialize the modifier and lock masks from the state of the opened devices.
+static void initialize_modifiers() {
+    hook->input.mask = 0x0000;
+
+    for (int i = 0; i < EVDEV_MAX_SOURCES; i++) {
+        evdev_source *source = hook->sources[i];
+        if (source == NULL) {
+            continue;
+        }
+
+        // Descriptors that are not devices simply fail these requests.
+        unsigned char keys[KEY_MAX / 8 + 1] = { 0 };
+        if (ioctl(source->fd, EVIOCGKEY(sizeof(keys)), keys) >= 0) {
+            if (TEST_BIT(keys, KEY_LEFTSHIFT))  { set_modifier_mask(MASK_SHIFT_L); }
+            if (TEST_BIT(keys, KEY_RIGHTSHIFT)) { set_modifier_mask(MASK_SHIFT_R); }
+            if (TEST_BIT(keys, KEY_LEFTCTRL))   { set_modifier_mask(MASK_CTRL_L);  }
+            if (TEST_BIT(keys, KEY_RIGHTCTRL))  { set_modifier_mask(MASK_CTRL_R);  }
+            if (TEST_BIT(keys, KEY_LEFTALT))    { set_modifier_mask(MASK_ALT_L);   }
+            if (TEST_BIT(keys, KEY_RIGHTALT))   { set_modifier_mask(MASK_ALT_R);   }
+            if (TEST_BIT(keys, KEY_LEFTMETA))   { set_modifier_mask(MASK_META_L);  }
+            if (TEST_BIT(keys, KEY_RIGHTMETA))  { set_modifier_mask(MASK_META_R);  }
+
+            if (TEST_BIT(keys, BTN_LEFT))       { set_modifier_mask(MASK_BUTTON1); }
+            if (TEST_BIT(keys, BTN_RIGHT))      { set_modifier_mask(MASK_BUTTON2); }
+            if (TEST_BIT(keys, BTN_MIDDLE))     { set_modifier_mask(MASK_BUTTON3); }
+            if (TEST_BIT(keys, BTN_SIDE))       { set_modifier_mask(MASK_BUTTON4); }
+            if (TEST_BIT(keys, BTN_EXTRA))      { set_modifier_mask(MASK_BUTTON5); }
+        }
+
+        unsigned char leds[LED_MAX / 8 + 1] = { 0 };
+        if (ioctl(source->fd, EVIOCGLED(sizeof(leds)), leds) >= 0) {
+            if (TEST_BIT(leds, LED_CAPSL))   { set_modifier_mask(MASK_CAPS_LOCK);   }
+            if (TEST_BIT(leds, LED_NUML))    { set_modifier_mask(MASK_NUM_LOCK);    }
+            if (TEST_BIT(leds, LED_SCROLLL)) { set_modifier_mask(MASK_SCROLL_LOCK); }
+        }
+    }
+}
+
+static void process_hook_enabled(uint64_t timestamp) {
+    // Initialize native input helper functions.
+    load_input_helper();
+
+    hook->receive_time = stats_now();
+
+    // Populate the hook start event.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.type = EVENT_HOOK_ENABLED;
+    event.mask = 0x00;
+
+    // Fire the hook start event.
+    dispatch_event(&event);
+}
+
+static void process_hook_disabled(uint64_t timestamp) {
+    hook->receive_time = stats_now();
+
+    // Populate the hook stop event.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.type = EVENT_HOOK_DISABLED;
+    event.mask = 0x00;
+
+    // Fire the hook stop event.
+    dispatch_event(&event);
+
+    // Deinitialize native input helper functions.
+    unload_input_helper();
+}
+
+static void process_key(uint64_t timestamp, uint16_t code, int32_t value) {
+    bool is_pressed = value != 0;
+    uint16_t scancode = keycode_to_scancode(code);
+
+    // TODO If you have a better suggestion for this ugly, let me know.
+    uint16_t modifier = 0x0000;
+    if      (scancode == VC_SHIFT_L)   { modifier = MASK_SHIFT_L; }
+    else if (scancode == VC_SHIFT_R)   { modifier = MASK_SHIFT_R; }
+    else if (scancode == VC_CONTROL_L) { modifier = MASK_CTRL_L;  }
+    else if (scancode == VC_CONTROL_R) { modifier = MASK_CTRL_R;  }
+    else if (scancode == VC_ALT_L)     { modifier = MASK_ALT_L;   }
+    else if (scancode == VC_ALT_R)     { modifier = MASK_ALT_R;   }
+    else if (scancode == VC_META_L)    { modifier = MASK_META_L;  }
+    else if (scancode == VC_META_R)    { modifier = MASK_META_R;  }
+
+    if (is_pressed) {
+        set_modifier_mask(modifier);
+    } else {
+        unset_modifier_mask(modifier);
+    }
+
+    // The kernel only reports the lock LEDs of real keyboards, toggle the
+    // locks on the initial press so recorded streams behave the same.
+    if (value == 1) {
+        if      (scancode == VC_CAPS_LOCK)   { hook->input.mask ^= MASK_CAPS_LOCK;   }
+        else if (scancode == VC_NUM_LOCK)    { hook->input.mask ^= MASK_NUM_LOCK;    }
+        else if (scancode == VC_SCROLL_LOCK) { hook->input.mask ^= MASK_SCROLL_LOCK; }
+    }
+
+    if ((get_modifiers() & MASK_NUM_LOCK) == 0) {
+        switch (scancode) {
+            case VC_KP_SEPARATOR:
+            case VC_KP_1:
+            case VC_KP_2:
+            case VC_KP_3:
+            case VC_KP_4:
+            case VC_KP_5:
+            case VC_KP_6:
+            case VC_KP_7:
+            case VC_KP_8:
+            case VC_KP_0:
+            case VC_KP_9:
+                scancode |= 0xEE00;
+                break;
+        }
+    }
+
+    if (!is_event_class_selected(EVENT_MASK_KEYBOARD)) {
+        return;
+    }
+
+    // Populate key event, auto repeat is delivered as another key press.
+    // There is no keyboard layout without a display server, so no key typed
+    // events are produced.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.type = is_pressed ? EVENT_KEY_PRESSED : EVENT_KEY_RELEASED;
+    event.mask = get_modifiers();
+
+    event.data.keyboard.keycode = scancode;
+    event.data.keyboard.rawcode = code;
+    event.data.keyboard.keychar = CHAR_UNDEFINED;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X %s. (%#X)\n",
+            __FUNCTION__, __LINE__, event.data.keyboard.keycode,
+            is_pressed ? "pressed" : "released", event.data.keyboard.rawcode);
+
+    // Fire key event.
+    dispatch_event(&event);
+}
+
+static void process_button_pressed(uint64_t timestamp, uint16_t button) {
+    // Track the number of clicks, the button must match the previous button.
+    if (button == hook->input.mouse.click.button && (long int) (timestamp - hook->input.mouse.click.time) <= EVDEV_MULTI_CLICK_TIME) {
+        if (hook->input.mouse.click.count < USHRT_MAX) {
+            hook->input.mouse.click.count++;
+        } else {
+            logger(LOG_LEVEL_WARN, "%s [%u]: Click count overflow detected!\n",
+                    __FUNCTION__, __LINE__);
+        }
+    } else {
+        // Reset the click count.
+        hook->input.mouse.click.count = 1;
+
+        // Set the previous button.
+        hook->input.mouse.click.button = button;
+    }
+
+    // Save this events time to calculate the hook->input.mouse.click.count.
+    hook->input.mouse.click.time = timestamp;
+
+    // Populate mouse pressed event.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.type = EVENT_MOUSE_PRESSED;
+    event.mask = get_modifiers();
+
+    event.data.mouse.button = button;
+    event.data.mouse.clicks = hook->input.mouse.click.count;
+    event.data.mouse.x = (int16_t) hook->input.mouse.x;
+    event.data.mouse.y = (int16_t) hook->input.mouse.y;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u  pressed %u time(s). (%u, %u)\n",
+            __FUNCTION__, __LINE__, event.data.mouse.button, event.data.mouse.clicks,
+            event.data.mouse.x, event.data.mouse.y);
+
+    // Fire mouse pressed event.
+    dispatch_event(&event);
+}
+
+static void process_button_released(uint64_t timestamp, uint16_t button) {
+    // Populate mouse released event.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.type = EVENT_MOUSE_RELEASED;
+    event.mask = get_modifiers();
+
+    event.data.mouse.button = button;
+    event.data.mouse.clicks = hook->input.mouse.click.count;
+    event.data.mouse.x = (int16_t) hook->input.mouse.x;
+    event.data.mouse.y = (int16_t) hook->input.mouse.y;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u released %u time(s). (%u, %u)\n",
+            __FUNCTION__, __LINE__, event.data.mouse.button,
+            event.data.mouse.clicks,
+            event.data.mouse.x, event.data.mouse.y);
+
+    // Fire mouse released event.
+    dispatch_event(&event);
+
+    // If the pressed event was not consumed...
+    if (event.reserved ^ 0x01 && hook->input.mouse.is_dragged != true) {
+        // Populate mouse clicked event.
+        event.time = timestamp;
+        event.receive_time = hook->receive_time;
+        event.reserved = 0x00;
+
+        event.type = EVENT_MOUSE_CLICKED;
+        event.mask = get_modifiers();
+
+        event.data.mouse.button = button;
+        event.data.mouse.clicks = hook->input.mouse.click.count;
+        event.data.mouse.x = (int16_t) hook->input.mouse.x;
+        event.data.mouse.y = (int16_t) hook->input.mouse.y;
+
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u clicked %u time(s). (%u, %u)\n",
+                __FUNCTION__, __LINE__, event.data.mouse.button,
+                event.data.mouse.clicks,
+                event.data.mouse.x, event.data.mouse.y);
+
+        // Fire mouse clicked event.
+        dispatch_event(&event);
+    }
+
+    // Reset the number of clicks.
+    if (button == hook->input.mouse.click.button && (long int) (event.time - hook->input.mouse.click.time) > EVDEV_MULTI_CLICK_TIME) {
+        // Reset the click count.
+        hook->input.mouse.click.count = 0;
+    }
+}
+
+static void process_button(uint64_t timestamp, uint16_t code, int32_t value) {
+    uint16_t button = MOUSE_NOBUTTON;
+    uint16_t modifier = 0x0000;
+    switch (code) {
+        case BTN_LEFT:
+        case BTN_TOUCH:
+            button = MOUSE_BUTTON1;
+            modifier = MASK_BUTTON1;
+            break;
+
+        case BTN_RIGHT:
+            button = MOUSE_BUTTON2;
+            modifier = MASK_BUTTON2;
+            break;
+
+        case BTN_MIDDLE:
+            button = MOUSE_BUTTON3;
+            modifier = MASK_BUTTON3;
+            break;
+
+        case BTN_SIDE:
+            button = MOUSE_BUTTON4;
+            modifier = MASK_BUTTON4;
+            break;
+
+        case BTN_EXTRA:
+            button = MOUSE_BUTTON5;
+            modifier = MASK_BUTTON5;
+            break;
+
+        default:
+            // Tool and stylus buttons are not mouse buttons.
+            return;
+    }
+
+    if (value != 0) {
+        set_modifier_mask(modifier);
+    } else {
+        unset_modifier_mask(modifier);
+    }
+
+    if (!is_event_class_selected(EVENT_MASK_MOUSE_BUTTON)) {
+        return;
+    }
+
+    if (value != 0) {
+        process_button_pressed(timestamp, button);
+    } else {
+        process_button_released(timestamp, button);
+    }
+}
+
+static void process_mouse_moved(uint64_t timestamp) {
+    // Reset the click count.
+    if (hook->input.mouse.click.count != 0 && (long int) (timestamp - hook->input.mouse.click.time) > EVDEV_MULTI_CLICK_TIME) {
+        hook->input.mouse.click.count = 0;
+    }
+
+    // Populate mouse move event.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.mask = get_modifiers();
+
+    // Check the upper half of virtual modifiers for non-zero values and set the mouse
+    // dragged flag.  The last 3 bits are reserved for lock masks.
+    hook->input.mouse.is_dragged = ((event.mask & 0x1F00) > 0);
+    if (hook->input.mouse.is_dragged) {
+        // Create Mouse Dragged event.
+        event.type = EVENT_MOUSE_DRAGGED;
+    } else {
+        // Create a Mouse Moved event.
+        event.type = EVENT_MOUSE_MOVED;
+    }
+
+    event.data.mouse.button = MOUSE_NOBUTTON;
+    event.data.mouse.clicks = hook->input.mouse.click.count;
+    event.data.mouse.x = (int16_t) hook->input.mouse.x;
+    event.data.mouse.y = (int16_t) hook->input.mouse.y;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Mouse %s to %i, %i. (%#X)\n",
+            __FUNCTION__, __LINE__, hook->input.mouse.is_dragged ? "dragged" : "moved",
+            event.data.mouse.x, event.data.mouse.y, event.mask);
+
+    // Fire mouse move event.
+    dispatch_event(&event);
+}
+
+static void process_mouse_wheel(uint64_t timestamp, uint8_t direction, int32_t value) {
+    // Reset the click count and previous button.
+    hook->input.mouse.click.count = 1;
+    hook->input.mouse.click.button = MOUSE_NOBUTTON;
+
+    // Populate mouse wheel event.
+    event.time = timestamp;
+    event.receive_time = hook->receive_time;
+    event.reserved = 0x00;
+
+    event.type = EVENT_MOUSE_WHEEL;
+    event.mask = get_modifiers();
+
+    event.data.wheel.clicks = hook->input.mouse.click.count;
+    event.data.wheel.x = (int16_t) hook->input.mouse.x;
+    event.data.wheel.y = (int16_t) hook->input.mouse.y;
+
+    // Use the same unit scroll values as the X11 backend.
+    event.data.wheel.type = WHEEL_UNIT_SCROLL;
+    event.data.wheel.amount = 3;
+
+    // Positive values are rotated up and away, or to the right.
+    if (direction == WHEEL_VERTICAL_DIRECTION) {
+        event.data.wheel.rotation = value > 0 ? -1 : 1;
+    } else {
+        event.data.wheel.rotation = value > 0 ? 1 : -1;
+    }
+    event.data.wheel.direction = direction;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Mouse wheel type %u, rotated %i units in the %u direction at %u, %u.\n",
+            __FUNCTION__, __LINE__, event.data.wheel.type,
+            event.data.wheel.amount * event.data.wheel.rotation,
+            event.data.wheel.direction,
+            event.data.wheel.x, event.data.wheel.y);
+
+    // Fire mouse wheel event.
+    dispatch_event(&event);
+}
+
+// Keep the tracked pointer inside the range of the event coordinates.
+static inline int32_t clamp_coordinate(int32_t value) {
+    if (value < INT16_MIN) {
+        return INT16_MIN;
+    } else if (value > INT16_MAX) {
+        return INT16_MAX;
+    }
+
+    return value;
+}
+
+static void process_input_event(struct input_event *ev) {
+    uint64_t timestamp = (uint64_t) ev->input_event_sec * 1000 + ev->input_event_usec / 1000;
+    hook->time = timestamp;
+
+    switch (ev->type) {
+        case EV_KEY:
+            if (ev->code < BTN_MISC) {
+                process_key(timestamp, ev->code, ev->value);
+            } else {
+                process_button(timestamp, ev->code, ev->value);
+            }
+            break;
+
+        case EV_REL:
+            if (ev->code == REL_X) {
+                hook->input.mouse.x = clamp_coordinate(hook->input.mouse.x + ev->value);
+                hook->input.mouse.is_moved = true;
+            } else if (ev->code == REL_Y) {
+                hook->input.mouse.y = clamp_coordinate(hook->input.mouse.y + ev->value);
+                hook->input.mouse.is_moved = true;
+            } else if (ev->code == REL_WHEEL && ev->value != 0 && is_event_class_selected(EVENT_MASK_MOUSE_BUTTON)) {
+                process_mouse_wheel(timestamp, WHEEL_VERTICAL_DIRECTION, ev->value);
+            } else if (ev->code == REL_HWHEEL && ev->value != 0 && is_event_class_selected(EVENT_MASK_MOUSE_BUTTON)) {
+                process_mouse_wheel(timestamp, WHEEL_HORIZONTAL_DIRECTION, ev->value);
+            }
+            break;
+
+        case EV_ABS:
+            // Absolute devices report in their own units, there is no screen to scale to.
+            if (ev->code == ABS_X) {
+                hook->input.mouse.x = clamp_coordinate(ev->value);
+                hook->input.mouse.is_moved = true;
+            } else if (ev->code == ABS_Y) {
+                hook->input.mouse.y = clamp_coordinate(ev->value);
+                hook->input.mouse.is_moved = true;
+            }
+            break;
+
+        case EV_SYN:
+            // Motion is reported once per device frame.
+            if (ev->code == SYN_REPORT && hook->input.mouse.is_moved) {
+                hook->input.mouse.is_moved = false;
+
+                if (is_event_class_selected(EVENT_MASK_MOUSE_MOTION)) {
+                    process_mouse_moved(timestamp);
+                }
+            }
+            break;
+    }
+}
+
+static int add_source(int fd, bool is_owned) {
+    for (int i = 0; i < EVDEV_MAX_SOURCES; i++) {
+        if (hook->sources[i] == NULL) {
+            evdev_source *source = malloc(sizeof(evdev_source));
+            if (source == NULL) {
+                logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for input source!\n",
+                        __FUNCTION__, __LINE__);
+
+                return UIOHOOK_ERROR_OUT_OF_MEMORY;
+            }
+
+            source->fd = fd;
+            source->is_owned = is_owned;
+            source->length = 0;
+
+            // Recorded input is always ready, it is read until the end of the file.
+            struct stat info;
+            source->is_file = fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+
+            struct epoll_event ep = {
+                .events = EPOLLIN,
+                .data.ptr = source
+            };
+
+            if (source->is_file) {
+                if (hook->file_fd < 0) {
+                    hook->file_fd = eventfd(1, EFD_CLOEXEC | EFD_NONBLOCK);
+
+                    ep.data.ptr = &hook->file_fd;
+                    if (hook->file_fd < 0 || epoll_ctl(hook->epoll_fd, EPOLL_CTL_ADD, hook->file_fd, &ep) != 0) {
+                        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create the file descriptor event! (%i)\n",
+                                __FUNCTION__, __LINE__, errno);
+
+                        if (hook->file_fd >= 0) {
+                            close(hook->file_fd);
+                            hook->file_fd = -1;
+                        }
+
+                        free(source);
+                        return UIOHOOK_FAILURE;
+                    }
+                }
+            } else if (epoll_ctl(hook->epoll_fd, EPOLL_CTL_ADD, fd, &ep) != 0) {
+                logger(LOG_LEVEL_ERROR, "%s [%u]: epoll_ctl failed for descriptor %i! (%i)\n",
+                        __FUNCTION__, __LINE__, fd, errno);
+
+                free(source);
+                return UIOHOOK_FAILURE;
+            }
+
+            hook->sources[i] = source;
+
+            return UIOHOOK_SUCCESS;
+        }
+    }
+
+    logger(LOG_LEVEL_WARN, "%s [%u]: Too many input sources, ignoring descriptor %i!\n",
+            __FUNCTION__, __LINE__, fd);
+
+    return UIOHOOK_FAILURE;
+}
+
+static void remove_source(evdev_source *source) {
+    for (int i = 0; i < EVDEV_MAX_SOURCES; i++) {
+        if (hook->sources[i] == source) {
+            hook->sources[i] = NULL;
+        }
+    }
+
+    if (!source->is_file) {
+        epoll_ctl(hook->epoll_fd, EPOLL_CTL_DEL, source->fd, NULL);
+    }
+
+    if (source->is_owned) {
+        close(source->fd);
+    }
+
+    free(source);
+}
+
+// Open every event device that can produce keyboard or pointer input.
+static void open_devices() {
+    DIR *dir = opendir(EVDEV_DEVICE_DIR);
+    if (dir == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to open %s! (%i)\n",
+                __FUNCTION__, __LINE__, EVDEV_DEVICE_DIR, errno);
+
+        return;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strncmp(entry->d_name, "event", 5) != 0) {
+            continue;
+        }
+
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "%s/%s", EVDEV_DEVICE_DIR, entry->d_name);
+
+        int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) {
+            logger(LOG_LEVEL_DEBUG, "%s [%u]: Could not open %s. (%i)\n",
+                    __FUNCTION__, __LINE__, path, errno);
+            continue;
+        }
+
+        unsigned long types = 0;
+        if (ioctl(fd, EVIOCGBIT(0, sizeof(types)), &types) < 0
+                || (types & ((1 << EV_KEY) | (1 << EV_REL) | (1 << EV_ABS))) == 0) {
+            close(fd);
+            continue;
+        }
+
+        // Report timestamps from the same clock as get_event_time().
+        int clock = CLOCK_MONOTONIC;
+        ioctl(fd, EVIOCSCLOCKID, &clock);
+
+        if (add_source(fd, true) == UIOHOOK_SUCCESS) {
+            logger(LOG_LEVEL_DEBUG, "%s [%u]: Reading input from %s.\n",
+                    __FUNCTION__, __LINE__, path);
+        } else {
+            close(fd);
+        }
+    }
+
+    closedir(dir);
+}
+
+// Translate events that were read together, they share one receive time.
+static void process_input_events(struct input_event *events, size_t count) {
+    uint64_t now = stats_now();
+    hook->receive_time = now;
+
+    stats_begin_translation(now);
+    for (size_t i = 0; i < count; i++) {
+        // Device timestamps use the monotonic clock, see open_devices().
+        uint64_t time = (uint64_t) events[i].input_event_sec * 1000000000 + (uint64_t) events[i].input_event_usec * 1000;
+        if (time <= now) {
+            stats_record_receive(now - time);
+        }
+
+        process_input_event(&events[i]);
+    }
+    stats_end_translation();
+}
+
+/* Read and process the complete input_event records available from the
+ * source.  Only one read is made so that descriptors passed in blocking mode
+ * do not stall the hook, the source is reported again while data remains.
+ * Pipes may split a record between reads, so the remainder is kept for the
+ * next read.
+ */
+static void read_source(evdev_source *source) {
+    struct input_event events[EVDEV_READ_COUNT];
+    events[0] = source->partial;
+
+    ssize_t size = read(source->fd, (unsigned char *) events + source->length, sizeof(events) - source->length);
+    if (size < 0) {
+        if (errno == EINTR || errno == EAGAIN) {
+            return;
+        }
+
+        logger(LOG_LEVEL_WARN, "%s [%u]: Removing input descriptor %i. (%i)\n",
+                __FUNCTION__, __LINE__, source->fd, errno);
+
+        remove_source(source);
+        return;
+    } else if (size == 0) {
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: End of input on descriptor %i.\n",
+                __FUNCTION__, __LINE__, source->fd);
+
+        remove_source(source);
+        return;
+    }
+
+    size_t length = source->length + (size_t) size;
+    size_t count = length / sizeof(struct input_event);
+
+    process_input_events(events, count);
+
+    source->length = length % sizeof(struct input_event);
+    if (source->length > 0) {
+        memcpy(&source->partial, &events[count], source->length);
+    }
+}
+
+// Read from every regular file source, the file event is closed once they all end.
+static void read_files() {
+    bool has_files = false;
+    for (int i = 0; i < EVDEV_MAX_SOURCES; i++) {
+        evdev_source *source = hook->sources[i];
+        if (source != NULL && source->is_file) {
+            read_source(source);
+
+            has_files |= hook->sources[i] != NULL;
+        }
+    }
+
+    if (!has_files) {
+        epoll_ctl(hook->epoll_fd, EPOLL_CTL_DEL, hook->file_fd, NULL);
+        close(hook->file_fd);
+        hook->file_fd = -1;
+    }
+}
+
+// Process everything that can be read without blocking.
+static void process_pending(int timeout) {
+    struct epoll_event ready[EVDEV_MAX_SOURCES + 2];
+
+    int count = epoll_wait(hook->epoll_fd, ready, EVDEV_MAX_SOURCES + 2, timeout);
+    for (int i = 0; i < count; i++) {
+        if (ready[i].data.ptr == &hook->file_fd) {
+            read_files();
+        } else if (ready[i].data.ptr != NULL) {
+            read_source((evdev_source *) ready[i].data.ptr);
+        }
+    }
+
+    // Everything read in one pass is delivered as a single batch.
+    flush_dispatch_batch();
+}
+
+static int hook_create() {
+    // Hook data for future cleanup.
+    hook = malloc(sizeof(hook_info));
+    if (hook == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for hook structure!\n",
+              __FUNCTION__, __LINE__);
+
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    hook->file_fd = -1;
+    hook->is_polled = false;
+    hook->time = get_event_time();
+    hook->receive_time = 0;
+    for (int i = 0; i < EVDEV_MAX_SOURCES; i++) {
+        hook->sources[i] = NULL;
+    }
+
+    hook->input.mask = 0x0000;
+    hook->input.mouse.is_dragged = false;
+    hook->input.mouse.is_moved = false;
+    hook->input.mouse.x = 0;
+    hook->input.mouse.y = 0;
+    hook->input.mouse.click.count = 0;
+    hook->input.mouse.click.time = 0;
+    hook->input.mouse.click.button = MOUSE_NOBUTTON;
+
+    hook->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    hook->stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (hook->epoll_fd < 0 || hook->stop_fd < 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create the epoll or event descriptor! (%i)\n",
+              __FUNCTION__, __LINE__, errno);
+
+        if (hook->epoll_fd >= 0) {
+            close(hook->epoll_fd);
+        }
+
+        if (hook->stop_fd >= 0) {
+            close(hook->stop_fd);
+        }
+
+        free(hook);
+        hook = NULL;
+
+        return UIOHOOK_FAILURE;
+    }
+
+    // The stop descriptor is the only one registered without a source.
+    struct epoll_event ep = {
+        .events = EPOLLIN,
+        .data.ptr = NULL
+    };
+    epoll_ctl(hook->epoll_fd, EPOLL_CTL_ADD, hook->stop_fd, &ep);
+
+    // Start the dispatch thread, if one was requested, before any events are produced.
+    int status = start_dispatch_queue();
+    if (status != UIOHOOK_SUCCESS) {
+        close(hook->stop_fd);
+        close(hook->epoll_fd);
+
+        free(hook);
+        hook = NULL;
+    }
+
+    return status;
+}
+
+// Read the descriptors from hook_add_input_fd(), or every device, and take the initial modifiers.
+static void open_sources() {
+    if (input_fd_count > 0) {
+        for (size_t i = 0; i < input_fd_count; i++) {
+            add_source(input_fds[i], false);
+        }
+    } else {
+        open_devices();
+    }
+
+    initialize_modifiers();
+}
+
+static void hook_destroy() {
+    for (int i = 0; i < EVDEV_MAX_SOURCES; i++) {
+        if (hook->sources[i] != NULL) {
+            remove_source(hook->sources[i]);
+        }
+    }
+
+    if (hook->file_fd >= 0) {
+        close(hook->file_fd);
+    }
+
+    close(hook->stop_fd);
+    close(hook->epoll_fd);
+
+    // Deliver anything still queued before returning.
+    stop_dispatch_queue();
+
+    // Free data associated with this hook.
+    free(hook);
+    hook = NULL;
+}
+
+UIOHOOK_API int hook_add_input_fd(int fd) {
+    if (fd < 0) {
+        input_fd_count = 0;
+    } else if (input_fd_count < EVDEV_MAX_SOURCES) {
+        input_fds[input_fd_count++] = fd;
+    } else {
+        logger(LOG_LEVEL_WARN, "%s [%u]: Too many input descriptors!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    return UIOHOOK_SUCCESS;
+}
+
+static int evdev_hook_set_event_mask(uint16_t mask) {
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Setting event mask to %#X.\n",
+            __FUNCTION__, __LINE__, mask);
+
+    // Devices cannot filter by event class, unselected events are dropped
+    // before translation.
+    __atomic_store_n(&event_mask, mask, __ATOMIC_RELAXED);
+
+    return UIOHOOK_SUCCESS;
+}
+
+int evdev_process_input_events(struct input_event *const events, size_t count) {
+    if (hook != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    int status = hook_create();
+    if (status != UIOHOOK_SUCCESS) {
+        return status;
+    }
+
+    process_hook_enabled(hook->time);
+
+    // Translate in blocks the size of one read, like process_pending().
+    for (size_t i = 0; i < count; i += EVDEV_READ_COUNT) {
+        process_input_events(&events[i], count - i < EVDEV_READ_COUNT ? count - i : EVDEV_READ_COUNT);
+        flush_dispatch_batch();
+    }
+
+    process_hook_disabled(get_event_time());
+    flush_dispatch_batch();
+
+    hook_destroy();
+
+    return UIOHOOK_SUCCESS;
+}
+
+static int evdev_hook_run() {
+    if (hook != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    int status = hook_create();
+    if (status != UIOHOOK_SUCCESS) {
+        return status;
+    }
+
+    open_sources();
+
+    process_hook_enabled(hook->time);
+
+    // Block until hook_stop() signals the stop descriptor.
+    uint64_t value = 0;
+    while (read(hook->stop_fd, &value, sizeof(value)) < 0) {
+        process_pending(-1);
+    }
+
+    process_hook_disabled(get_event_time());
+    flush_dispatch_batch();
+
+    hook_destroy();
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Something, something, something, complete.\n",
+            __FUNCTION__, __LINE__);
+
+    return status;
+}
+
+static int evdev_hook_start() {
+    if (hook != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    int status = hook_create();
+    if (status == UIOHOOK_SUCCESS) {
+        open_sources();
+
+        // Events are read by hook_process_pending() on the caller's thread.
+        hook->is_polled = true;
+
+        process_hook_enabled(hook->time);
+        flush_dispatch_batch();
+    }
+
+    return status;
+}
+
+static int evdev_hook_get_fd() {
+    if (hook == NULL || !hook->is_polled) {
+        return -1;
+    }
+
+    return hook->epoll_fd;
+}
+
+static int evdev_hook_process_pending() {
+    if (hook == NULL || !hook->is_polled) {
+        return UIOHOOK_FAILURE;
+    }
+
+    process_pending(0);
+
+    return UIOHOOK_SUCCESS;
+}
+
+static int evdev_hook_stop() {
+    int status = UIOHOOK_FAILURE;
+
+    if (hook != NULL) {
+        if (hook->is_polled) {
+            process_hook_disabled(get_event_time());
+            flush_dispatch_batch();
+
+            // There is no hook thread to clean up after an event loop driven hook.
+            hook_destroy();
+        } else {
+            uint64_t value = 1;
+            if (write(hook->stop_fd, &value, sizeof(value)) < 0) {
+                logger(LOG_LEVEL_WARN, "%s [%u]: Failed to wake the hook loop! (%i)\n",
+                        __FUNCTION__, __LINE__, errno);
+            }
+        }
+
+        status = UIOHOOK_SUCCESS;
+    }
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Status: %#X.\n",
+            __FUNCTION__, __LINE__, status);
+
+    return status;
+}
+
+static uint64_t evdev_time_to_monotonic(uint64_t time) {
+    // Event times are already taken from the monotonic clock.
+    return time * 1000000;
+}
+
+static bool evdev_is_available() {
+    return input_fd_count > 0 || access(EVDEV_DEVICE_DIR, R_OK) == 0;
+}
+
+const hook_backend evdev_backend = {
+    .type = BACKEND_EVDEV,
+    .is_available = evdev_is_available,
+
+    .run = evdev_hook_run,
+    .stop = evdev_hook_stop,
+    .start = evdev_hook_start,
+    .get_fd = evdev_hook_get_fd,
+    .process_pending = evdev_hook_process_pending,
+    .set_event_mask = evdev_hook_set_event_mask,
+    .time_to_monotonic = evdev_time_to_monotonic,
+
+    .post_event = evdev_post_event,
+
+    .create_screen_info = evdev_create_screen_info,
+    .get_auto_repeat_rate = evdev_get_auto_repeat_rate,
+    .get_auto_repeat_delay = evdev_get_auto_repeat_delay,
+    .get_pointer_acceleration_multiplier = evdev_get_pointer_acceleration_multiplier,
+    .get_pointer_acceleration_threshold = evdev_get_pointer_acceleration_threshold,
+    .get_pointer_sensitivity = evdev_get_pointer_sensitivity,
+    .get_multi_click_time = evdev_get_multi_click_time
+};
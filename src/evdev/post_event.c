@@ -0,0 +1,219 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <linux/uinput.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <uiohook.h>
+#include <unistd.h>
+
+#include "input_helper.h"
+#include "logger.h"
+
+#define UINPUT_DEVICE_PATH "/dev/uinput"
+#define UINPUT_DEVICE_NAME "libuiohook"
+
+static pthread_mutex_t uinput_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int uinput_fd = -1;
+
+// Last position posted, used to turn absolute coordinates into relative motion.
+static int16_t current_x = 0;
+static int16_t current_y = 0;
+
+// Create the virtual device on first use, it lives until the library is unloaded.
+static int open_uinput_device() {
+    if (uinput_fd >= 0) {
+        return UIOHOOK_SUCCESS;
+    }
+
+    int fd = open(UINPUT_DEVICE_PATH, O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to open %s! (%i)\n",
+                __FUNCTION__, __LINE__, UINPUT_DEVICE_PATH, errno);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_KEY);
+    for (int code = KEY_ESC; code < KEY_MAX; code++) {
+        ioctl(fd, UI_SET_KEYBIT, code);
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_REL);
+    ioctl(fd, UI_SET_RELBIT, REL_X);
+    ioctl(fd, UI_SET_RELBIT, REL_Y);
+    ioctl(fd, UI_SET_RELBIT, REL_WHEEL);
+    ioctl(fd, UI_SET_RELBIT, REL_HWHEEL);
+
+    struct uinput_setup setup;
+    memset(&setup, 0, sizeof(setup));
+    setup.id.bustype = BUS_VIRTUAL;
+    strncpy(setup.name, UINPUT_DEVICE_NAME, UINPUT_MAX_NAME_SIZE - 1);
+
+    if (ioctl(fd, UI_DEV_SETUP, &setup) < 0 || ioctl(fd, UI_DEV_CREATE) < 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create the uinput device! (%i)\n",
+                __FUNCTION__, __LINE__, errno);
+
+        close(fd);
+        return UIOHOOK_FAILURE;
+    }
+
+    uinput_fd = fd;
+
+    return UIOHOOK_SUCCESS;
+}
+
+static void write_input_event(uint16_t type, uint16_t code, int32_t value) {
+    struct input_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.type = type;
+    ev.code = code;
+    ev.value = value;
+
+    if (write(uinput_fd, &ev, sizeof(ev)) != sizeof(ev)) {
+        logger(LOG_LEVEL_WARN, "%s [%u]: Failed to write input event %#X! (%i)\n",
+                __FUNCTION__, __LINE__, type, errno);
+    }
+}
+
+static int post_key_event(uiohook_event * const event) {
+    uint16_t keycode = scancode_to_keycode(event->data.keyboard.keycode);
+    if (keycode == 0x0000) {
+        logger(LOG_LEVEL_WARN, "%s [%u]: Unable to lookup scancode: %li\n",
+                __FUNCTION__, __LINE__, event->data.keyboard.keycode);
+        return UIOHOOK_FAILURE;
+    }
+
+    write_input_event(EV_KEY, keycode, event->type == EVENT_KEY_PRESSED ? 1 : 0);
+
+    return UIOHOOK_SUCCESS;
+}
+
+static int post_mouse_button_event(uiohook_event * const event) {
+    uint16_t code;
+    switch (event->data.mouse.button) {
+        case MOUSE_BUTTON1:
+            code = BTN_LEFT;
+            break;
+
+        case MOUSE_BUTTON2:
+            code = BTN_RIGHT;
+            break;
+
+        case MOUSE_BUTTON3:
+            code = BTN_MIDDLE;
+            break;
+
+        case MOUSE_BUTTON4:
+            code = BTN_SIDE;
+            break;
+
+        case MOUSE_BUTTON5:
+            code = BTN_EXTRA;
+            break;
+
+        default:
+            logger(LOG_LEVEL_WARN, "%s [%u]: Unsupported mouse button: %u\n",
+                    __FUNCTION__, __LINE__, event->data.mouse.button);
+            return UIOHOOK_FAILURE;
+    }
+
+    write_input_event(EV_KEY, code, event->type == EVENT_MOUSE_PRESSED ? 1 : 0);
+
+    return UIOHOOK_SUCCESS;
+}
+
+static void post_mouse_wheel_event(uiohook_event * const event) {
+    // Wheel rotation is the inverse of the kernel direction for vertical scrolling.
+    if (event->data.wheel.direction == WHEEL_HORIZONTAL_DIRECTION) {
+        write_input_event(EV_REL, REL_HWHEEL, event->data.wheel.rotation);
+    } else {
+        write_input_event(EV_REL, REL_WHEEL, -event->data.wheel.rotation);
+    }
+}
+
+static void post_mouse_motion_event(uiohook_event * const event) {
+    // A relative device cannot be positioned, move by the distance from the last posted point.
+    write_input_event(EV_REL, REL_X, event->data.mouse.x - current_x);
+    write_input_event(EV_REL, REL_Y, event->data.mouse.y - current_y);
+
+    current_x = event->data.mouse.x;
+    current_y = event->data.mouse.y;
+}
+
+void evdev_post_event(uiohook_event * const event) {
+    pthread_mutex_lock(&uinput_mutex);
+
+    if (open_uinput_device() != UIOHOOK_SUCCESS) {
+        pthread_mutex_unlock(&uinput_mutex);
+        return; // UIOHOOK_FAILURE
+    }
+
+    switch (event->type) {
+        case EVENT_KEY_PRESSED:
+        case EVENT_KEY_RELEASED:
+            post_key_event(event);
+            break;
+
+        case EVENT_MOUSE_PRESSED:
+        case EVENT_MOUSE_RELEASED:
+            post_mouse_button_event(event);
+            break;
+
+        case EVENT_MOUSE_WHEEL:
+            post_mouse_wheel_event(event);
+            break;
+
+        case EVENT_MOUSE_MOVED:
+        case EVENT_MOUSE_DRAGGED:
+            post_mouse_motion_event(event);
+            break;
+
+        case EVENT_KEY_TYPED:
+        case EVENT_MOUSE_CLICKED:
+
+        case EVENT_HOOK_ENABLED:
+        case EVENT_HOOK_DISABLED:
+
+        default:
+            logger(LOG_LEVEL_WARN, "%s [%u]: Ignoring post event type %#X\n",
+                __FUNCTION__, __LINE__, event->type);
+            break;
+    }
+
+    // Don't forget to flush!
+    write_input_event(EV_SYN, SYN_REPORT, 0);
+
+    pthread_mutex_unlock(&uinput_mutex);
+}
+
+// Create a shared object destructor.
+__attribute__ ((destructor))
+static void on_library_unload() {
+    if (uinput_fd >= 0) {
+        ioctl(uinput_fd, UI_DEV_DESTROY);
+        close(uinput_fd);
+        uinput_fd = -1;
+    }
+}
@@ -0,0 +1,130 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/input.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <uiohook.h>
+#include <unistd.h>
+
+#include "input_helper.h"
+#include "logger.h"
+
+#define EVDEV_DEVICE_DIR "/dev/input"
+
+// The kernel defaults for devices with software auto repeat, see input_register_device().
+#define EVDEV_REPEAT_DELAY 250
+#define EVDEV_REPEAT_PERIOD 33
+
+/* Read the kernel auto repeat settings from the first device that supports
+ * them.  The values are returned in milliseconds as [REP_DELAY, REP_PERIOD].
+ */
+static bool get_auto_repeat(unsigned int repeat[2]) {
+    bool successful = false;
+
+    DIR *dir = opendir(EVDEV_DEVICE_DIR);
+    if (dir == NULL) {
+        logger(LOG_LEVEL_WARN, "%s [%u]: Failed to open %s!\n",
+                __FUNCTION__, __LINE__, EVDEV_DEVICE_DIR);
+
+        return successful;
+    }
+
+    struct dirent *entry;
+    while (!successful && (entry = readdir(dir)) != NULL) {
+        if (strncmp(entry->d_name, "event", 5) != 0) {
+            continue;
+        }
+
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "%s/%s", EVDEV_DEVICE_DIR, entry->d_name);
+
+        int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+
+        unsigned long types = 0;
+        if (ioctl(fd, EVIOCGBIT(0, sizeof(types)), &types) >= 0 && (types & (1 << EV_REP))) {
+            successful = ioctl(fd, EVIOCGREP, repeat) >= 0;
+
+            if (successful) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: EVIOCGREP on %s: %u, %u.\n",
+                        __FUNCTION__, __LINE__, path, repeat[REP_DELAY], repeat[REP_PERIOD]);
+            }
+        }
+
+        close(fd);
+    }
+
+    closedir(dir);
+
+    return successful;
+}
+
+screen_data* evdev_create_screen_info(unsigned char *count) {
+    // There is no display server to ask for the screen layout.
+    *count = 0;
+
+    return NULL;
+}
+
+long int evdev_get_auto_repeat_rate() {
+    long int value = EVDEV_REPEAT_PERIOD;
+    unsigned int repeat[2];
+
+    if (get_auto_repeat(repeat)) {
+        value = (long int) repeat[REP_PERIOD];
+    }
+
+    return value;
+}
+
+long int evdev_get_auto_repeat_delay() {
+    long int value = EVDEV_REPEAT_DELAY;
+    unsigned int repeat[2];
+
+    if (get_auto_repeat(repeat)) {
+        value = (long int) repeat[REP_DELAY];
+    }
+
+    return value;
+}
+
+long int evdev_get_pointer_acceleration_multiplier() {
+    // Pointer acceleration is applied by the compositor, not the kernel.
+    return -1;
+}
+
+long int evdev_get_pointer_acceleration_threshold() {
+    return -1;
+}
+
+long int evdev_get_pointer_sensitivity() {
+    return -1;
+}
+
+long int evdev_get_multi_click_time() {
+    return -1;
+}
@@ -0,0 +1,182 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <uiohook.h>
+
+#include "hook_stats.h"
+
+// Larger receive delays mean the server clock is not the local monotonic clock.
+#define STATS_SERVER_TIME_LIMIT 60000
+
+static hook_stats stats;
+
+// Start of the translation in progress, 0 outside of translation.
+static uint64_t translation_start = 0;
+
+/* Bumped by hook_reset_stats().  The writers clear their own counters once
+ * they see a new generation, and until then a snapshot reports them as zero.
+ */
+static unsigned int reset_generation = 0;
+static unsigned int hook_generation = 0;
+static unsigned int dispatch_generation = 0;
+
+/* Each counter has a single writer, the hook thread or the dispatch thread, so
+ * a relaxed load and store is enough and avoids a locked instruction per
+ * update.  Readers may see a snapshot that is a few events behind.
+ */
+static inline void counter_add(uint64_t *counter, uint64_t value) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+static void clear_histogram(hook_histogram *histogram) {
+    __atomic_store_n(&histogram->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&histogram->total, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&histogram->max, 0, __ATOMIC_RELAXED);
+
+    for (size_t i = 0; i < HOOK_STATS_BUCKETS; i++) {
+        __atomic_store_n(&histogram->buckets[i], 0, __ATOMIC_RELAXED);
+    }
+}
+
+static void copy_histogram(hook_histogram *target, hook_histogram *source, bool is_current) {
+    target->count = is_current ? __atomic_load_n(&source->count, __ATOMIC_RELAXED) : 0;
+    target->total = is_current ? __atomic_load_n(&source->total, __ATOMIC_RELAXED) : 0;
+    target->max = is_current ? __atomic_load_n(&source->max, __ATOMIC_RELAXED) : 0;
+
+    for (size_t i = 0; i < HOOK_STATS_BUCKETS; i++) {
+        target->buckets[i] = is_current ? __atomic_load_n(&source->buckets[i], __ATOMIC_RELAXED) : 0;
+    }
+}
+
+// Clear the counters written by the thread producing events after a reset.
+static inline void sync_hook_counters() {
+    unsigned int generation = __atomic_load_n(&reset_generation, __ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&hook_generation, __ATOMIC_RELAXED) != generation) {
+        for (size_t i = 0; i <= EVENT_KEYBOARD_LAYOUT_CHANGED; i++) {
+            __atomic_store_n(&stats.events[i], 0, __ATOMIC_RELAXED);
+        }
+
+        clear_histogram(&stats.receive);
+        clear_histogram(&stats.translate);
+
+        __atomic_store_n(&hook_generation, generation, __ATOMIC_RELEASE);
+    }
+}
+
+// Clear the counters written by the thread calling the dispatcher after a reset.
+static inline void sync_dispatch_counters() {
+    unsigned int generation = __atomic_load_n(&reset_generation, __ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&dispatch_generation, __ATOMIC_RELAXED) != generation) {
+        clear_histogram(&stats.dispatch);
+
+        __atomic_store_n(&dispatch_generation, generation, __ATOMIC_RELEASE);
+    }
+}
+
+static inline void record_sample(hook_histogram *histogram, uint64_t elapsed) {
+    unsigned int bucket = 0;
+    if (elapsed > 1) {
+        bucket = 63 - __builtin_clzll(elapsed);
+        if (bucket >= HOOK_STATS_BUCKETS) {
+            bucket = HOOK_STATS_BUCKETS - 1;
+        }
+    }
+
+    counter_add(&histogram->buckets[bucket], 1);
+    counter_add(&histogram->count, 1);
+    counter_add(&histogram->total, elapsed);
+
+    if (elapsed > __atomic_load_n(&histogram->max, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&histogram->max, elapsed, __ATOMIC_RELAXED);
+    }
+}
+
+uint64_t stats_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+void stats_record_receive(uint64_t elapsed) {
+    sync_hook_counters();
+    record_sample(&stats.receive, elapsed);
+}
+
+void stats_record_server_time(uint32_t server_time, uint64_t now) {
+    // The server time wraps every 49.7 days, so compare in 32 bits.
+    uint32_t elapsed = (uint32_t) (now / 1000000) - server_time;
+    if (elapsed < STATS_SERVER_TIME_LIMIT) {
+        sync_hook_counters();
+        record_sample(&stats.receive, (uint64_t) elapsed * 1000000);
+    }
+}
+
+void stats_begin_translation(uint64_t now) {
+    translation_start = now;
+}
+
+void stats_end_translation() {
+    translation_start = 0;
+}
+
+void stats_record_event(event_type type) {
+    sync_hook_counters();
+
+    if (type <= EVENT_KEYBOARD_LAYOUT_CHANGED) {
+        counter_add(&stats.events[type], 1);
+    }
+
+    if (translation_start != 0) {
+        record_sample(&stats.translate, stats_now() - translation_start);
+    }
+}
+
+void stats_resume_translation() {
+    if (translation_start != 0) {
+        translation_start = stats_now();
+    }
+}
+
+void stats_record_dispatch(uint64_t elapsed) {
+    sync_dispatch_counters();
+    record_sample(&stats.dispatch, elapsed);
+}
+
+UIOHOOK_API void hook_get_stats(hook_stats *snapshot) {
+    unsigned int generation = __atomic_load_n(&reset_generation, __ATOMIC_ACQUIRE);
+    bool is_hook_current = __atomic_load_n(&hook_generation, __ATOMIC_ACQUIRE) == generation;
+    bool is_dispatch_current = __atomic_load_n(&dispatch_generation, __ATOMIC_ACQUIRE) == generation;
+
+    for (size_t i = 0; i <= EVENT_KEYBOARD_LAYOUT_CHANGED; i++) {
+        snapshot->events[i] = is_hook_current ? __atomic_load_n(&stats.events[i], __ATOMIC_RELAXED) : 0;
+    }
+
+    copy_histogram(&snapshot->receive, &stats.receive, is_hook_current);
+    copy_histogram(&snapshot->translate, &stats.translate, is_hook_current);
+    copy_histogram(&snapshot->dispatch, &stats.dispatch, is_dispatch_current);
+}
+
+UIOHOOK_API void hook_reset_stats() {
+    // The counters are cleared by their writers, see sync_hook_counters().
+    __atomic_add_fetch(&reset_generation, 1, __ATOMIC_RELEASE);
+}
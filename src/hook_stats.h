@@ -0,0 +1,56 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_hook_stats
+#define _included_hook_stats
+
+#include <stdint.h>
+#include <uiohook.h>
+
+/* Returns the monotonic clock in nanoseconds.
+ */
+extern uint64_t stats_now();
+
+/* Record the delay between the system timestamping the input and the hook
+ * receiving it.
+ */
+extern void stats_record_receive(uint64_t elapsed);
+
+/* Record the delay for input timestamped in milliseconds by an X server, which
+ * uses the monotonic clock when it runs on the same host, and received at the
+ * given stats_now() time.  Times that do not fit the local clock are ignored.
+ */
+extern void stats_record_server_time(uint32_t server_time, uint64_t now);
+
+/* Start timing the translation of one native event at the given stats_now()
+ * time, and end it.  Only called from the thread that produces events.
+ */
+extern void stats_begin_translation(uint64_t now);
+extern void stats_end_translation();
+
+/* Record one event handed to the dispatcher.  The translation time is split
+ * around the dispatcher so a synchronous callback is not counted twice.
+ */
+extern void stats_record_event(event_type type);
+extern void stats_resume_translation();
+
+/* Record the time spent in the dispatch callback.
+ */
+extern void stats_record_dispatch(uint64_t elapsed);
+
+#endif
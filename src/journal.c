@@ -0,0 +1,482 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <uiohook.h>
+#include <unistd.h>
+
+#include "journal.h"
+#include "logger.h"
+
+// Number of events the hook thread can queue between writer wakeups.
+#define JOURNAL_QUEUE_SIZE 16384
+
+// Encoded bytes held before they are written to the file.
+#define JOURNAL_BUFFER_SIZE (1024 * 1024)
+
+// Longest possible encoded record.
+#define JOURNAL_RECORD_MAX 32
+
+// Time between writer wakeups in milliseconds.
+#define JOURNAL_FLUSH_INTERVAL 100
+
+// Wakeups before a partly filled buffer is written anyway.
+#define JOURNAL_SYNC_WAKEUPS 10
+
+/* Single-producer, single-consumer ring of raw events plus the encoder state.
+ * The hook thread only copies events into the ring, so recording costs it one
+ * event copy.  The writer thread polls the ring, encodes the events and
+ * writes the file in large blocks.
+ */
+typedef struct _journal_writer {
+    uiohook_event *events;
+    size_t mask;
+    size_t head;
+    size_t tail;
+    unsigned long int dropped;
+    bool is_running;
+    bool is_failed;
+    int fd;
+
+    // Encoder state, only used by the writer thread.
+    journal_state state;
+    unsigned char *data;
+    size_t length;
+    unsigned int wakeups;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t thread;
+} journal_writer;
+static journal_writer *journal = NULL;
+
+// Number of producers that may still be using the journal after it was detached.
+static unsigned int journal_users = 0;
+
+// Serializes hook_start_journal() and hook_stop_journal().
+static pthread_mutex_t journal_control = PTHREAD_MUTEX_INITIALIZER;
+
+void journal_record_event(uiohook_event *const event) {
+    if (__atomic_load_n(&journal, __ATOMIC_RELAXED) == NULL) {
+        return;
+    }
+
+    // Announce the use before loading the journal again, so a concurrent stop
+    // either sees this producer or this producer sees the journal detached.
+    __atomic_add_fetch(&journal_users, 1, __ATOMIC_SEQ_CST);
+    journal_writer *writer = __atomic_load_n(&journal, __ATOMIC_SEQ_CST);
+    if (writer != NULL) {
+        size_t head = __atomic_load_n(&writer->head, __ATOMIC_RELAXED);
+        size_t tail = __atomic_load_n(&writer->tail, __ATOMIC_ACQUIRE);
+
+        if (head - tail > writer->mask) {
+            __atomic_add_fetch(&writer->dropped, 1, __ATOMIC_RELAXED);
+        } else {
+            writer->events[head & writer->mask] = *event;
+            __atomic_store_n(&writer->head, head + 1, __ATOMIC_RELEASE);
+        }
+    }
+    __atomic_sub_fetch(&journal_users, 1, __ATOMIC_RELEASE);
+}
+
+static inline void put_byte(journal_writer *writer, unsigned char value) {
+    writer->data[writer->length++] = value;
+}
+
+static inline void put_varint(journal_writer *writer, uint64_t value) {
+    while (value >= 0x80) {
+        writer->data[writer->length++] = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    writer->data[writer->length++] = (unsigned char) value;
+}
+
+// Map signed values to unsigned so small negative differences stay short.
+static inline void put_signed(journal_writer *writer, int64_t value) {
+    put_varint(writer, ((uint64_t) value << 1) ^ (uint64_t) (value >> 63));
+}
+
+static inline void put_position(journal_writer *writer, int16_t x, int16_t y) {
+    put_signed(writer, (int32_t) x - writer->state.x);
+    put_signed(writer, (int32_t) y - writer->state.y);
+    writer->state.x = x;
+    writer->state.y = y;
+}
+
+static void encode_event(journal_writer *writer, uiohook_event *const event) {
+    size_t start = writer->length++;
+    unsigned char tag = event->type & JOURNAL_TYPE_MASK;
+
+    put_signed(writer, (int64_t) (event->time - writer->state.time));
+    writer->state.time = event->time;
+
+    if (event->mask != writer->state.modifiers) {
+        tag |= JOURNAL_FLAG_MASK;
+        put_varint(writer, event->mask);
+        writer->state.modifiers = event->mask;
+    }
+
+    switch (event->type) {
+        case EVENT_KEY_TYPED:
+        case EVENT_KEY_PRESSED:
+        case EVENT_KEY_RELEASED:
+            put_varint(writer, event->data.keyboard.keycode);
+            put_varint(writer, event->data.keyboard.rawcode);
+            put_varint(writer, (uint16_t) (event->data.keyboard.keychar + 1));
+            break;
+
+        case EVENT_MOUSE_CLICKED:
+        case EVENT_MOUSE_PRESSED:
+        case EVENT_MOUSE_RELEASED:
+        case EVENT_MOUSE_MOVED:
+        case EVENT_MOUSE_DRAGGED:
+            if (event->data.mouse.button == writer->state.button && event->data.mouse.clicks == writer->state.clicks) {
+                tag |= JOURNAL_FLAG_REPEAT;
+            } else {
+                put_varint(writer, event->data.mouse.button);
+                put_varint(writer, event->data.mouse.clicks);
+                writer->state.button = event->data.mouse.button;
+                writer->state.clicks = event->data.mouse.clicks;
+            }
+            put_position(writer, event->data.mouse.x, event->data.mouse.y);
+            break;
+
+        case EVENT_MOUSE_WHEEL:
+            put_varint(writer, event->data.wheel.clicks);
+            put_position(writer, event->data.wheel.x, event->data.wheel.y);
+            put_byte(writer, event->data.wheel.type);
+            put_varint(writer, event->data.wheel.amount);
+            put_signed(writer, event->data.wheel.rotation);
+            put_byte(writer, event->data.wheel.direction);
+            break;
+
+        default:
+            break;
+    }
+
+    writer->data[start] = tag;
+}
+
+static inline unsigned char get_byte(journal_reader *reader) {
+    if (reader->offset >= reader->length) {
+        reader->is_corrupt = true;
+        return 0;
+    }
+
+    return reader->data[reader->offset++];
+}
+
+static inline uint64_t get_varint(journal_reader *reader) {
+    uint64_t value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+        unsigned char byte = get_byte(reader);
+        value |= (uint64_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+
+    reader->is_corrupt = true;
+    return 0;
+}
+
+static inline int64_t get_signed(journal_reader *reader) {
+    uint64_t value = get_varint(reader);
+    return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+static inline void get_position(journal_reader *reader, int16_t *x, int16_t *y) {
+    reader->state.x = (int16_t) (reader->state.x + get_signed(reader));
+    reader->state.y = (int16_t) (reader->state.y + get_signed(reader));
+    *x = reader->state.x;
+    *y = reader->state.y;
+}
+
+bool journal_open_reader(journal_reader *reader, const unsigned char *data, size_t length) {
+    memset(reader, 0, sizeof(journal_reader));
+    if (length < JOURNAL_HEADER_SIZE
+            || memcmp(data, JOURNAL_MAGIC, JOURNAL_HEADER_SIZE - 1) != 0
+            || data[JOURNAL_HEADER_SIZE - 1] != JOURNAL_VERSION) {
+        return false;
+    }
+
+    reader->data = data;
+    reader->length = length;
+    reader->offset = JOURNAL_HEADER_SIZE;
+
+    return true;
+}
+
+bool journal_read_event(journal_reader *reader, uiohook_event *const event) {
+    if (reader->offset >= reader->length || reader->is_corrupt) {
+        return false;
+    }
+
+    unsigned char tag = get_byte(reader);
+
+    memset(event, 0, sizeof(uiohook_event));
+    event->type = tag & JOURNAL_TYPE_MASK;
+
+    reader->state.time += get_signed(reader);
+    event->time = reader->state.time;
+
+    if (tag & JOURNAL_FLAG_MASK) {
+        reader->state.modifiers = (uint16_t) get_varint(reader);
+    }
+    event->mask = reader->state.modifiers;
+
+    switch (event->type) {
+        case EVENT_KEY_TYPED:
+        case EVENT_KEY_PRESSED:
+        case EVENT_KEY_RELEASED:
+            event->data.keyboard.keycode = (uint16_t) get_varint(reader);
+            event->data.keyboard.rawcode = (uint16_t) get_varint(reader);
+            event->data.keyboard.keychar = (uint16_t) (get_varint(reader) - 1);
+            break;
+
+        case EVENT_MOUSE_CLICKED:
+        case EVENT_MOUSE_PRESSED:
+        case EVENT_MOUSE_RELEASED:
+        case EVENT_MOUSE_MOVED:
+        case EVENT_MOUSE_DRAGGED:
+            if (!(tag & JOURNAL_FLAG_REPEAT)) {
+                reader->state.button = (uint16_t) get_varint(reader);
+                reader->state.clicks = (uint16_t) get_varint(reader);
+            }
+            event->data.mouse.button = reader->state.button;
+            event->data.mouse.clicks = reader->state.clicks;
+            get_position(reader, &event->data.mouse.x, &event->data.mouse.y);
+            break;
+
+        case EVENT_MOUSE_WHEEL:
+            event->data.wheel.clicks = (uint16_t) get_varint(reader);
+            get_position(reader, &event->data.wheel.x, &event->data.wheel.y);
+            event->data.wheel.type = get_byte(reader);
+            event->data.wheel.amount = (uint16_t) get_varint(reader);
+            event->data.wheel.rotation = (int16_t) get_signed(reader);
+            event->data.wheel.direction = get_byte(reader);
+            break;
+
+        default:
+            break;
+    }
+
+    return !reader->is_corrupt;
+}
+
+// Write out the encoded bytes, later bytes are discarded once a write fails.
+static void write_journal(journal_writer *writer) {
+    size_t offset = 0;
+    while (offset < writer->length && !writer->is_failed) {
+        ssize_t count = write(writer->fd, writer->data + offset, writer->length - offset);
+        if (count >= 0) {
+            offset += count;
+        } else if (errno != EINTR) {
+            logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to write event journal! (%#X)\n",
+                    __FUNCTION__, __LINE__, errno);
+
+            writer->is_failed = true;
+        }
+    }
+
+    writer->length = 0;
+    writer->wakeups = 0;
+}
+
+// Encode every queued event, writing out the buffer whenever it fills up.
+static void drain_journal(journal_writer *writer) {
+    size_t tail = writer->tail;
+    size_t head = __atomic_load_n(&writer->head, __ATOMIC_ACQUIRE);
+
+    while (tail != head) {
+        if (writer->length > JOURNAL_BUFFER_SIZE - JOURNAL_RECORD_MAX) {
+            write_journal(writer);
+        }
+
+        encode_event(writer, &writer->events[tail & writer->mask]);
+        tail++;
+
+        // Hand the slot back to the hook thread.
+        __atomic_store_n(&writer->tail, tail, __ATOMIC_RELEASE);
+    }
+}
+
+static void *journal_thread_proc(void *arg) {
+    journal_writer *writer = (journal_writer *) arg;
+
+    pthread_mutex_lock(&writer->mutex);
+    while (writer->is_running) {
+        drain_journal(writer);
+
+        // Keep the file reasonably current when events are sparse.
+        if (writer->length >= JOURNAL_BUFFER_SIZE / 2
+                || (writer->length > 0 && ++writer->wakeups >= JOURNAL_SYNC_WAKEUPS)) {
+            write_journal(writer);
+        }
+
+        struct timespec timeout;
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        timeout.tv_nsec += JOURNAL_FLUSH_INTERVAL * 1000000L;
+        if (timeout.tv_nsec >= 1000000000L) {
+            timeout.tv_sec++;
+            timeout.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait(&writer->cond, &writer->mutex, &timeout);
+    }
+
+    // Write out everything recorded before the stop.
+    drain_journal(writer);
+    write_journal(writer);
+    pthread_mutex_unlock(&writer->mutex);
+
+    return NULL;
+}
+
+static void destroy_journal(journal_writer *writer) {
+    pthread_cond_destroy(&writer->cond);
+    pthread_mutex_destroy(&writer->mutex);
+    close(writer->fd);
+    free(writer->data);
+    free(writer->events);
+    free(writer);
+}
+
+UIOHOOK_API int hook_start_journal(const char *path) {
+    pthread_mutex_lock(&journal_control);
+    if (journal != NULL) {
+        logger(LOG_LEVEL_WARN, "%s [%u]: An event journal is already being recorded!\n",
+                __FUNCTION__, __LINE__);
+
+        pthread_mutex_unlock(&journal_control);
+        return UIOHOOK_FAILURE;
+    }
+
+    journal_writer *writer = calloc(1, sizeof(journal_writer));
+    if (writer == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for event journal!\n",
+                __FUNCTION__, __LINE__);
+
+        pthread_mutex_unlock(&journal_control);
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    writer->events = malloc(sizeof(uiohook_event) * JOURNAL_QUEUE_SIZE);
+    writer->data = malloc(JOURNAL_BUFFER_SIZE);
+    if (writer->events == NULL || writer->data == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for event journal buffers!\n",
+                __FUNCTION__, __LINE__);
+
+        free(writer->data);
+        free(writer->events);
+        free(writer);
+
+        pthread_mutex_unlock(&journal_control);
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    writer->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (writer->fd < 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to open event journal %s! (%#X)\n",
+                __FUNCTION__, __LINE__, path, errno);
+
+        free(writer->data);
+        free(writer->events);
+        free(writer);
+
+        pthread_mutex_unlock(&journal_control);
+        return UIOHOOK_FAILURE;
+    }
+
+    writer->mask = JOURNAL_QUEUE_SIZE - 1;
+    writer->is_running = true;
+
+    memcpy(writer->data, JOURNAL_MAGIC, JOURNAL_HEADER_SIZE - 1);
+    writer->data[JOURNAL_HEADER_SIZE - 1] = JOURNAL_VERSION;
+    writer->length = JOURNAL_HEADER_SIZE;
+
+    pthread_mutex_init(&writer->mutex, NULL);
+    pthread_cond_init(&writer->cond, NULL);
+
+    if (pthread_create(&writer->thread, NULL, journal_thread_proc, writer) != 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create journal thread!\n",
+                __FUNCTION__, __LINE__);
+
+        destroy_journal(writer);
+
+        pthread_mutex_unlock(&journal_control);
+        return UIOHOOK_ERROR_THREAD_CREATE;
+    }
+
+    __atomic_store_n(&journal, writer, __ATOMIC_SEQ_CST);
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Recording event journal to %s.\n",
+            __FUNCTION__, __LINE__, path);
+
+    pthread_mutex_unlock(&journal_control);
+    return UIOHOOK_SUCCESS;
+}
+
+UIOHOOK_API int hook_stop_journal() {
+    int status = UIOHOOK_SUCCESS;
+
+    pthread_mutex_lock(&journal_control);
+    journal_writer *writer = __atomic_exchange_n(&journal, NULL, __ATOMIC_SEQ_CST);
+    if (writer != NULL) {
+        // Wait for a producer that loaded the journal before it was detached.
+        while (__atomic_load_n(&journal_users, __ATOMIC_SEQ_CST) > 0) {
+            sched_yield();
+        }
+
+        pthread_mutex_lock(&writer->mutex);
+        writer->is_running = false;
+        pthread_cond_signal(&writer->cond);
+        pthread_mutex_unlock(&writer->mutex);
+
+        pthread_join(writer->thread, NULL);
+
+        if (writer->dropped > 0) {
+            logger(LOG_LEVEL_WARN, "%s [%u]: Dropped %lu events due to journal queue overflow.\n",
+                    __FUNCTION__, __LINE__, writer->dropped);
+        }
+
+        if (writer->is_failed) {
+            status = UIOHOOK_FAILURE;
+        }
+
+        destroy_journal(writer);
+    }
+    pthread_mutex_unlock(&journal_control);
+
+    return status;
+}
+
+// Write out the journal before the library is unloaded.
+__attribute__ ((destructor))
+static void on_journal_unload() {
+    hook_stop_journal();
+}
@@ -0,0 +1,85 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_journal
+#define _included_journal
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uiohook.h>
+
+/* Journal files start with an 8 byte header, the magic "UIOHJRN" followed by
+ * the format version, and then hold one record per event:
+ *
+ *   tag       1 byte, the event type in the low nibble and JOURNAL_FLAG_* bits
+ *   time      zigzag varint, difference to the time of the previous record
+ *   mask      varint, only if JOURNAL_FLAG_MASK is set
+ *   data      depends on the event type
+ *
+ * Keyboard events store the keycode, rawcode and keychar plus one, so
+ * CHAR_UNDEFINED takes a single byte, as varints.  Mouse
+ * events store the button and clicks as varints unless JOURNAL_FLAG_REPEAT is
+ * set, then the position as zigzag varint differences to the previous mouse or
+ * wheel event.  Wheel events store the clicks, position, type, amount,
+ * rotation and direction the same way.  Hook enabled and disabled events have
+ * no data.  Varints are little endian base 128.
+ */
+#define JOURNAL_MAGIC           "UIOHJRN"
+#define JOURNAL_VERSION         1
+#define JOURNAL_HEADER_SIZE     8
+
+#define JOURNAL_TYPE_MASK       0x0F
+#define JOURNAL_FLAG_MASK       0x10    // Modifier mask differs from the previous record
+#define JOURNAL_FLAG_REPEAT     0x20    // Button and clicks match the previous mouse event
+
+// Fields of the previous record that the next record is encoded against.
+typedef struct _journal_state {
+    uint64_t time;
+    uint16_t modifiers;
+    uint16_t button;
+    uint16_t clicks;
+    int16_t x;
+    int16_t y;
+} journal_state;
+
+// Decoder over a journal that is already in memory.
+typedef struct _journal_reader {
+    const unsigned char *data;
+    size_t length;
+    size_t offset;
+    bool is_corrupt;
+    journal_state state;
+} journal_reader;
+
+/* Copy an event into the journal if one is being recorded.  Only called from
+ * the thread that produces events, the copy never waits for the writer.
+ */
+extern void journal_record_event(uiohook_event *const event);
+
+/* Check the journal header and prepare the reader to decode the records that
+ * follow it.  Returns false if the data is not a journal of this version.
+ */
+extern bool journal_open_reader(journal_reader *reader, const unsigned char *data, size_t length);
+
+/* Decode the next record into the event.  Returns false at the end of the
+ * journal, is_corrupt is set if the journal ended inside a record.
+ */
+extern bool journal_read_event(journal_reader *reader, uiohook_event *const event);
+
+#endif
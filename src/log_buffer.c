@@ -0,0 +1,269 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <uiohook.h>
+
+#include "logger.h"
+
+// Longest formatted message, longer messages are truncated.
+#define LOG_RECORD_LENGTH 256
+
+// Time between background flushes in milliseconds.
+#define LOG_FLUSH_INTERVAL 100
+
+typedef struct _log_record {
+    size_t sequence;
+    unsigned int level;
+    char message[LOG_RECORD_LENGTH];
+} log_record;
+
+/* Bounded multi-producer ring of preallocated records.  Any thread may log, so
+ * producers claim a slot by advancing head with a compare and swap and
+ * publish it through the slot sequence, they never take a lock or wait.  Only
+ * the flush holds the mutex, which keeps the records in order when the
+ * background thread and hook_flush_log() race.
+ */
+typedef struct _log_buffer {
+    log_record *records;
+    size_t mask;
+    size_t head;
+    size_t tail;
+    unsigned long int dropped;
+    bool is_running;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t thread;
+} log_buffer;
+static log_buffer *buffer = NULL;
+
+// Number of producers that may still be using the buffer after it was detached.
+static unsigned int buffer_users = 0;
+
+// Format a message into the next free record, the message is dropped if the ring is full.
+static bool write_record(log_buffer *ring, unsigned int level, const char *format, va_list args) {
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    log_record *record;
+    while (true) {
+        record = &ring->records[head & ring->mask];
+
+        size_t sequence = __atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE);
+        if (sequence == head) {
+            // The slot is free, claim it unless another producer got there first.
+            if (__atomic_compare_exchange_n(&ring->head, &head, head + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if ((ptrdiff_t) (sequence - head) < 0) {
+            // The slot still holds a record from the previous lap.
+            __atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        } else {
+            head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    record->level = level;
+    vsnprintf(record->message, LOG_RECORD_LENGTH, format, args);
+
+    __atomic_store_n(&record->sequence, head + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+static bool buffered_logger(unsigned int level, const char *format, ...) {
+    if (__atomic_load_n(&buffer, __ATOMIC_RELAXED) == NULL) {
+        return false;
+    }
+
+    bool is_buffered = false;
+
+    // Announce the use before loading the buffer again, so a concurrent stop
+    // either sees this producer or this producer sees the buffer detached.
+    __atomic_add_fetch(&buffer_users, 1, __ATOMIC_SEQ_CST);
+    log_buffer *ring = __atomic_load_n(&buffer, __ATOMIC_SEQ_CST);
+    if (ring != NULL) {
+        va_list args;
+        va_start(args, format);
+        is_buffered = write_record(ring, level, format, args);
+        va_end(args);
+    }
+    __atomic_sub_fetch(&buffer_users, 1, __ATOMIC_RELEASE);
+
+    return is_buffered;
+}
+
+// Write out every published record, must be called with the mutex held.
+static void flush_records(log_buffer *ring) {
+    size_t tail = ring->tail;
+    while (true) {
+        log_record *record = &ring->records[tail & ring->mask];
+        if (__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) != tail + 1) {
+            break;
+        }
+
+        user_logger(record->level, "%s", record->message);
+
+        // Hand the slot back to the producers for the next lap.
+        __atomic_store_n(&record->sequence, tail + ring->mask + 1, __ATOMIC_RELEASE);
+        tail++;
+    }
+    ring->tail = tail;
+
+    unsigned long int dropped = __atomic_exchange_n(&ring->dropped, 0, __ATOMIC_RELAXED);
+    if (dropped > 0 && LOG_LEVEL_WARN >= logger_threshold) {
+        user_logger(LOG_LEVEL_WARN, "%s [%u]: Dropped %lu log messages due to log buffer overflow.\n",
+                __FUNCTION__, __LINE__, dropped);
+    }
+}
+
+static void *log_thread_proc(void *arg) {
+    log_buffer *ring = (log_buffer *) arg;
+
+    pthread_mutex_lock(&ring->mutex);
+    while (ring->is_running) {
+        flush_records(ring);
+
+        struct timespec timeout;
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        timeout.tv_nsec += LOG_FLUSH_INTERVAL * 1000000L;
+        if (timeout.tv_nsec >= 1000000000L) {
+            timeout.tv_sec++;
+            timeout.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait(&ring->cond, &ring->mutex, &timeout);
+    }
+
+    // Write out anything logged before the stop.
+    flush_records(ring);
+    pthread_mutex_unlock(&ring->mutex);
+
+    return NULL;
+}
+
+static void stop_log_buffer() {
+    log_buffer *ring = __atomic_exchange_n(&buffer, NULL, __ATOMIC_SEQ_CST);
+    if (ring != NULL) {
+        // Messages logged from here on go straight to the logger callback.
+        set_logger_wrapper(NULL);
+
+        // Wait for a producer that loaded the buffer before it was detached.
+        while (__atomic_load_n(&buffer_users, __ATOMIC_SEQ_CST) > 0) {
+            sched_yield();
+        }
+
+        pthread_mutex_lock(&ring->mutex);
+        ring->is_running = false;
+        pthread_cond_signal(&ring->cond);
+        pthread_mutex_unlock(&ring->mutex);
+
+        pthread_join(ring->thread, NULL);
+
+        pthread_cond_destroy(&ring->cond);
+        pthread_mutex_destroy(&ring->mutex);
+        free(ring->records);
+        free(ring);
+    }
+}
+
+UIOHOOK_API int hook_set_log_buffer_size(size_t size) {
+    stop_log_buffer();
+
+    if (size == 0) {
+        return UIOHOOK_SUCCESS;
+    }
+
+    // Round the capacity up to a power of two so the index can be masked.
+    size_t capacity = 1;
+    while (capacity < size && capacity < SIZE_MAX / 2) {
+        capacity <<= 1;
+    }
+
+    log_buffer *ring = malloc(sizeof(log_buffer));
+    if (ring == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for log buffer!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    ring->records = malloc(sizeof(log_record) * capacity);
+    if (ring->records == NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to allocate memory for %zu log records!\n",
+                __FUNCTION__, __LINE__, capacity);
+
+        free(ring);
+
+        return UIOHOOK_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t i = 0; i < capacity; i++) {
+        ring->records[i].sequence = i;
+    }
+
+    ring->mask = capacity - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+    ring->is_running = true;
+    pthread_mutex_init(&ring->mutex, NULL);
+    pthread_cond_init(&ring->cond, NULL);
+
+    if (pthread_create(&ring->thread, NULL, log_thread_proc, ring) != 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create log thread!\n",
+                __FUNCTION__, __LINE__);
+
+        pthread_cond_destroy(&ring->cond);
+        pthread_mutex_destroy(&ring->mutex);
+        free(ring->records);
+        free(ring);
+
+        return UIOHOOK_ERROR_THREAD_CREATE;
+    }
+
+    __atomic_store_n(&buffer, ring, __ATOMIC_RELEASE);
+    set_logger_wrapper(&buffered_logger);
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Started log thread with a %zu record buffer.\n",
+            __FUNCTION__, __LINE__, capacity);
+
+    return UIOHOOK_SUCCESS;
+}
+
+UIOHOOK_API void hook_flush_log() {
+    log_buffer *ring = __atomic_load_n(&buffer, __ATOMIC_ACQUIRE);
+    if (ring != NULL) {
+        pthread_mutex_lock(&ring->mutex);
+        flush_records(ring);
+        pthread_mutex_unlock(&ring->mutex);
+    }
+}
+
+// Write out buffered messages before the library is unloaded.
+__attribute__ ((destructor))
+static void on_log_buffer_unload() {
+    stop_log_buffer();
+}
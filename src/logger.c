@@ -29,12 +29,44 @@ static bool default_logger(unsigned int level, const char *format, ...) {
 }
 
 // Current logger function pointer, should never be null.
-logger_t logger = &default_logger;
+logger_t current_logger = &default_logger;
+
+// Callback set with hook_set_logger_proc(), current_logger may wrap it.
+logger_t user_logger = &default_logger;
+static logger_t wrapper_logger = NULL;
+
+// Level requested with hook_set_log_level().
+static unsigned int logger_level = LOG_LEVEL_DEBUG;
+
+// Nothing is passed to the default logger, it would discard it anyway.
+unsigned int logger_threshold = LOG_LEVEL_ERROR + 1;
+
+static void update_logger() {
+    if (user_logger == &default_logger) {
+        current_logger = &default_logger;
+        logger_threshold = LOG_LEVEL_ERROR + 1;
+    } else {
+        current_logger = wrapper_logger != NULL ? wrapper_logger : user_logger;
+        logger_threshold = logger_level;
+    }
+}
+
+void set_logger_wrapper(logger_t wrapper) {
+    wrapper_logger = wrapper;
+    update_logger();
+}
 
 UIOHOOK_API void hook_set_logger_proc(logger_t logger_proc) {
     if (logger_proc == NULL) {
-        logger = &default_logger;
+        user_logger = &default_logger;
     } else {
-        logger = logger_proc;
+        user_logger = logger_proc;
     }
+
+    update_logger();
+}
+
+UIOHOOK_API void hook_set_log_level(log_level level) {
+    logger_level = level;
+    update_logger();
 }
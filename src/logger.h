@@ -26,7 +26,35 @@
 #define __FUNCTION__ __func__
 #endif
 
-// logger(level, message)
-extern logger_t logger;
+// Lowest level compiled into the library, calls below it are removed entirely.
+#ifndef UIOHOOK_LOG_LEVEL
+#define UIOHOOK_LOG_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+// Current logger function pointer, should never be null.
+extern logger_t current_logger;
+
+// Callback set with hook_set_logger_proc().
+extern logger_t user_logger;
+
+/* Route messages through wrapper, which forwards them to user_logger, or
+ * restore direct calls when wrapper is NULL.
+ */
+extern void set_logger_wrapper(logger_t wrapper);
+
+// Lowest level passed to current_logger, above LOG_LEVEL_ERROR while no logger is set.
+extern unsigned int logger_threshold;
+
+/* logger(level, message)
+ *
+ * The level is checked before the arguments are evaluated, so disabled
+ * messages cost a compare and never reach the logger callback.
+ */
+#define logger(level, ...) \
+    do { \
+        if ((level) >= UIOHOOK_LOG_LEVEL && (level) >= logger_threshold) { \
+            current_logger((level), __VA_ARGS__); \
+        } \
+    } while (0)
 
 #endif
@@ -0,0 +1,203 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <uiohook.h>
+#include <unistd.h>
+
+#include "hook_stats.h"
+#include "journal.h"
+#include "logger.h"
+
+// Longest sleep in nanoseconds before checking for hook_stop_replay().
+#define REPLAY_STOP_INTERVAL 50000000ULL
+
+// Set by hook_stop_replay() and cleared when the next replay starts.
+static bool is_replay_stopped = false;
+
+/* Schedule for one replay.  Each event is posted at an absolute monotonic
+ * time derived from the first event, so the time spent posting and any late
+ * wakeup are not added to the gaps that follow.
+ */
+typedef struct _replay_clock {
+    double speed;
+    bool is_started;
+    uint64_t first_time;
+    uint64_t start;
+    uint64_t target;
+} replay_clock;
+
+// Sleep until the monotonic target time, returns false if the replay was stopped.
+static bool wait_until(uint64_t target) {
+    while (!__atomic_load_n(&is_replay_stopped, __ATOMIC_RELAXED)) {
+        uint64_t now = stats_now();
+        if (now >= target) {
+            return true;
+        }
+
+        uint64_t wake = target;
+        if (target - now > REPLAY_STOP_INTERVAL) {
+            wake = now + REPLAY_STOP_INTERVAL;
+        }
+
+        struct timespec timeout = {
+            .tv_sec = wake / 1000000000ULL,
+            .tv_nsec = wake % 1000000000ULL
+        };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &timeout, NULL);
+    }
+
+    return false;
+}
+
+// Post one event at its scheduled time, returns false if the replay was stopped.
+static bool replay_event(replay_clock *clock, uiohook_event *const event) {
+    switch (event->type) {
+        case EVENT_KEY_PRESSED:
+        case EVENT_KEY_RELEASED:
+        case EVENT_MOUSE_PRESSED:
+        case EVENT_MOUSE_RELEASED:
+        case EVENT_MOUSE_MOVED:
+        case EVENT_MOUSE_DRAGGED:
+        case EVENT_MOUSE_WHEEL:
+            break;
+
+        default:
+            // Typed, clicked and hook events follow from the events that are posted.
+            return true;
+    }
+
+    if (!clock->is_started) {
+        clock->is_started = true;
+        clock->first_time = event->time;
+        clock->start = stats_now();
+        clock->target = clock->start;
+    }
+
+    if (clock->speed > 0) {
+        // Event times are in milliseconds, never schedule an event before the previous one.
+        int64_t elapsed = (int64_t) (event->time - clock->first_time);
+        if (elapsed > 0) {
+            uint64_t target = clock->start + (uint64_t) ((double) elapsed * 1000000.0 / clock->speed);
+            if (target > clock->target) {
+                clock->target = target;
+            }
+        }
+
+        if (!wait_until(clock->target)) {
+            return false;
+        }
+    } else if (__atomic_load_n(&is_replay_stopped, __ATOMIC_RELAXED)) {
+        return false;
+    }
+
+    uiohook_event copy = *event;
+    hook_post_event(&copy);
+
+    return true;
+}
+
+UIOHOOK_API int hook_replay_events(uiohook_event *const events, size_t count, double speed) {
+    __atomic_store_n(&is_replay_stopped, false, __ATOMIC_RELAXED);
+
+    replay_clock clock = { .speed = speed };
+    for (size_t i = 0; i < count; i++) {
+        if (!replay_event(&clock, &events[i])) {
+            logger(LOG_LEVEL_DEBUG, "%s [%u]: Replay stopped after %zu of %zu events.\n",
+                    __FUNCTION__, __LINE__, i, count);
+            break;
+        }
+    }
+
+    return UIOHOOK_SUCCESS;
+}
+
+UIOHOOK_API int hook_replay_journal(const char *path, double speed) {
+    __atomic_store_n(&is_replay_stopped, false, __ATOMIC_RELAXED);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to open event journal %s! (%#X)\n",
+                __FUNCTION__, __LINE__, path, errno);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to read event journal %s!\n",
+                __FUNCTION__, __LINE__, path);
+
+        close(fd);
+        return UIOHOOK_FAILURE;
+    }
+
+    // Decode straight from the mapping, the journal is never copied into memory.
+    size_t length = (size_t) info.st_size;
+    const unsigned char *data = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to map event journal %s! (%#X)\n",
+                __FUNCTION__, __LINE__, path, errno);
+
+        return UIOHOOK_FAILURE;
+    }
+    madvise((void *) data, length, MADV_SEQUENTIAL);
+
+    int status = UIOHOOK_SUCCESS;
+
+    journal_reader reader;
+    if (journal_open_reader(&reader, data, length)) {
+        replay_clock clock = { .speed = speed };
+
+        uiohook_event event;
+        while (journal_read_event(&reader, &event)) {
+            if (!replay_event(&clock, &event)) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: Replay stopped at offset %zu of %zu.\n",
+                        __FUNCTION__, __LINE__, reader.offset, length);
+                break;
+            }
+        }
+
+        if (reader.is_corrupt) {
+            // A journal that was not stopped cleanly may end inside a record.
+            logger(LOG_LEVEL_WARN, "%s [%u]: Event journal %s ends inside a record.\n",
+                    __FUNCTION__, __LINE__, path);
+        }
+    } else {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: File %s is not a version %u event journal!\n",
+                __FUNCTION__, __LINE__, path, JOURNAL_VERSION);
+
+        status = UIOHOOK_FAILURE;
+    }
+
+    munmap((void *) data, length);
+
+    return status;
+}
+
+UIOHOOK_API void hook_stop_replay() {
+    __atomic_store_n(&is_replay_stopped, true, __ATOMIC_RELAXED);
+}
@@ -19,8 +19,11 @@
 #ifndef _included_input_helper
 #define _included_input_helper
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <uiohook.h>
 #include <X11/Xlib.h>
+#include <X11/extensions/record.h>
 
 #ifdef USE_XKB_COMMON
 #include <X11/Xlib-xcb.h>
@@ -43,6 +46,21 @@
 // Helper display used by input helper, properties and post event.
 extern Display *helper_disp;
 
+// Server side settings that are cached by the hook.
+typedef enum _settings_type {
+    SETTINGS_SCREEN_LAYOUT = 0,
+    SETTINGS_POINTER_MAPPING,
+    SETTINGS_INDICATOR_STATE,
+    SETTINGS_RESOURCE_MANAGER,
+    SETTINGS_TYPE_COUNT
+} settings_type;
+
+/* Returns the change serial for the given settings type.  The settings thread
+ * increments the serial each time the X server reports a change, so a cached
+ * copy only needs to be refreshed when its saved serial no longer matches.
+ */
+extern unsigned int get_settings_serial(settings_type type);
+
 /* Converts a X11 key symbol to a single Unicode character.  No direct X11
  * functionality exists to provide this information.
  */
@@ -61,6 +79,28 @@ extern uint16_t keycode_to_scancode(KeyCode keycode);
  */
 extern KeyCode scancode_to_keycode(uint16_t scancode);
 
+// Translation of a key code at a single group and shift level of the keymap.
+typedef struct _key_translation {
+    KeySym keysym;
+    uint16_t count;
+    uint16_t unicode[2];
+} key_translation;
+
+// Key translation state for one keyboard layout.
+typedef struct _keyboard_layout keyboard_layout;
+
+/* Builds the key translation state for the current keyboard layout using the
+ * given display connection.  Called by the settings thread after the server
+ * reports a new keyboard or keymap, returns NULL while no hook is loaded.
+ */
+extern keyboard_layout * create_keyboard_layout(Display *display);
+
+/* Hands a layout built by create_keyboard_layout() to the hook thread, which
+ * swaps it in before its next batch of input.  A previously published layout
+ * that was not picked up yet is released.
+ */
+extern void publish_keyboard_layout(keyboard_layout *layout);
+
 
 #ifdef USE_XKB_COMMON
 
@@ -69,6 +109,13 @@ extern KeyCode scancode_to_keycode(uint16_t scancode);
  */
 extern size_t keycode_to_unicode(struct xkb_state* state, KeyCode keycode, uint16_t *buffer, size_t size);
 
+/* Translates a X11 key code to its key symbol and Unicode character sequence
+ * for the current state.  The result is read from a cache built with the
+ * keymap, only Control and unconsumed Caps Lock transformations are passed on
+ * to libXKBCommon.
+ */
+extern void keycode_to_translation(struct xkb_state *state, KeyCode keycode, key_translation *translation);
+
 /* Create a xkb_state structure and return a pointer to it.
  */
 extern struct xkb_state * create_xkb_state(struct xkb_context *context, xcb_connection_t *connection);
@@ -77,6 +124,12 @@ extern struct xkb_state * create_xkb_state(struct xkb_context *context, xcb_conn
  */
 extern void destroy_xkb_state(struct xkb_state* state);
 
+/* Swaps in a keyboard layout published by the settings thread.  Releases the
+ * given state and returns the state of the new layout, or returns the given
+ * state unchanged if no layout was published.
+ */
+extern struct xkb_state * update_xkb_state(struct xkb_state *state);
+
 #else
 
 /* Converts a X11 key code and event mask to the appropriate X11 key symbol.
@@ -85,6 +138,17 @@ extern void destroy_xkb_state(struct xkb_state* state);
  */
 extern KeySym keycode_to_keysym(KeyCode keycode, unsigned int modifier_mask);
 
+/* Translates a X11 key code and event mask to its key symbol and Unicode
+ * character sequence.  The result is read from a cache built by
+ * load_input_helper() so only the shift level is resolved per call.
+ */
+extern void keycode_to_translation(KeyCode keycode, unsigned int modifier_mask, key_translation *translation);
+
+/* Swaps in a keyboard layout published by the settings thread.  Returns true
+ * if the layout was replaced.
+ */
+extern bool update_keyboard_map();
+
 #endif
 
 /* Lookup a X11 buttons possible remapping and return that value.
@@ -92,9 +156,8 @@ extern KeySym keycode_to_keysym(KeyCode keycode, unsigned int modifier_mask);
 extern unsigned int button_map_lookup(unsigned int button);
 
 /* Initialize items required for KeyCodeToKeySym() and KeySymToUnicode()
- * functionality.  This method is called by OnLibraryLoad() and may need to be
- * called in combination with UnloadInputHelper() if the native keyboard layout
- * is changed.
+ * functionality.  This method is called when the hook is enabled, later keyboard
+ * layout changes are picked up with update_keyboard_map() or update_xkb_state().
  */
 extern void load_input_helper();
 
@@ -105,4 +168,28 @@ extern void load_input_helper();
  */
 extern void unload_input_helper();
 
+// Backend entry points implemented by post_event.c and system_properties.c.
+extern void x11_post_event(uiohook_event * const event);
+
+extern screen_data* x11_create_screen_info(unsigned char *count);
+
+extern long int x11_get_auto_repeat_rate();
+
+extern long int x11_get_auto_repeat_delay();
+
+extern long int x11_get_pointer_acceleration_multiplier();
+
+extern long int x11_get_pointer_acceleration_threshold();
+
+extern long int x11_get_pointer_sensitivity();
+
+extern long int x11_get_multi_click_time();
+
+/* Translate and dispatch prebuilt XRecord data between a hook enabled and a
+ * hook disabled event, exactly as if it was received from the X server.  No
+ * connection is needed, lookups that require one fall back to their defaults.
+ * Used to benchmark the translation path, fails while a hook is running.
+ */
+extern int x11_process_recorded_data(XRecordInterceptData *const data, size_t count);
+
 #endif
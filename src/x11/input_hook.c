@@ -19,11 +19,17 @@
 #include <inttypes.h>
 #include <limits.h>
 
-#ifdef USE_XRECORD_ASYNC
-#include <pthread.h>
+#if defined(USE_XRECORD_ASYNC) || defined(USE_XINPUT2)
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <uiohook.h>
 
 #include <xcb/xkb.h>
@@ -34,6 +40,10 @@
 #include <X11/Xlib.h>
 #include <X11/extensions/record.h>
 
+#ifdef USE_XINPUT2
+#include <X11/extensions/XInput2.h>
+#endif
+
 #if defined(USE_XINERAMA) && !defined(USE_XRANDR)
 #include <X11/extensions/Xinerama.h>
 #elif defined(USE_XRANDR)
@@ -44,25 +54,47 @@
 #pragma message("... Assuming single-head display.")
 #endif
 
-#include "logger.h"
+#include "backend.h"
+#include "dispatch_event.h"
+#include "hook_stats.h"
 #include "input_helper.h"
+#include "logger.h"
+
+// Pipe used by hook_stop() to wake the asynchronous XRecord or XInput2 loop.
+#if defined(USE_XRECORD_ASYNC) || defined(USE_XINPUT2)
+static int stop_pipe[2] = { -1, -1 };
+
+// Commands written to the stop pipe, only WAKE_STOP ends the loop.
+#define WAKE_STOP           's'
+#define WAKE_EVENT_MASK     'm'
+#endif
+
+#ifdef USE_XINPUT2
+// Set by the backend entry points, XRecord is used when raw events are not selected.
+static bool is_xinput_selected = false;
 
-// Thread and hook handles.
-#ifdef USE_XRECORD_ASYNC
-static bool running;
+// Number of slave devices whose pointer axes are remembered.
+#define XINPUT_DEVICE_MAX   16
 
-static pthread_cond_t hook_xrecord_cond = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t hook_xrecord_mutex = PTHREAD_MUTEX_INITIALIZER;
+// Longest time in nanoseconds a moving pointer is followed without asking the server.
+#define XINPUT_SYNC_INTERVAL    100000000
 #endif
 
 typedef struct _hook_info {
+    struct _clock {
+        uint64_t server_time;
+        uint64_t receive_time;
+    } clock;
     struct _data {
         Display *display;
-        XRecordRange *range;
+        XRecordRange *ranges[3];
+        int range_count;
+        bool is_async;
     } data;
     struct _ctrl {
         Display *display;
         XRecordContext context;
+        bool is_polled;
     } ctrl;
     struct _input {
         #ifdef USE_XKB_COMMON
@@ -70,15 +102,46 @@ typedef struct _hook_info {
         struct xkb_context *context;
         #endif
         uint16_t mask;
+        unsigned int lock_serial;
         struct _mouse {
             bool is_dragged;
             struct _click {
                 unsigned short int count;
                 long int time;
                 unsigned short int button;
+                long int interval;
+                unsigned int serial;
             } click;
         } mouse;
     } input;
+    struct _screen {
+        unsigned int serial;
+        int16_t x;
+        int16_t y;
+    } screen;
+    #ifdef USE_XINPUT2
+    struct _xinput {
+        int opcode;
+        uint16_t mask;
+        uint64_t time;
+        double x;
+        double y;
+        bool is_clamped;
+        bool is_moved;
+        uint64_t sync_time;
+        int stale_count;
+        struct _root {
+            unsigned int serial;
+            int width;
+            int height;
+        } root;
+        int device_count;
+        struct _device {
+            int id;
+            bool is_tracked;
+        } devices[XINPUT_DEVICE_MAX];
+    } xinput;
+    #endif
 } hook_info;
 static hook_info *hook;
 
@@ -96,31 +159,15 @@ typedef union {
 static struct xkb_state *state = NULL;
 #endif
 
+// Monotonic nanoseconds at server time 0, read by hook_time_to_monotonic() from any thread.
+static int64_t server_time_offset = 0;
+static bool is_server_time_mapped = false;
+
 // Virtual event pointer.
 static uiohook_event event;
 
-// Event dispatch callback.
-static dispatcher_t dispatcher = NULL;
-
-UIOHOOK_API void hook_set_dispatch_proc(dispatcher_t dispatch_proc) {
-    logger(LOG_LEVEL_DEBUG, "%s [%u]: Setting new dispatch callback to %#p.\n",
-            __FUNCTION__, __LINE__, dispatch_proc);
-
-    dispatcher = dispatch_proc;
-}
-
-// Send out an event if a dispatcher was set.
-static inline void dispatch_event(uiohook_event *const event) {
-    if (dispatcher != NULL) {
-        logger(LOG_LEVEL_DEBUG, "%s [%u]: Dispatching event type %u.\n",
-                __FUNCTION__, __LINE__, event->type);
-
-        dispatcher(event);
-    } else {
-        logger(LOG_LEVEL_WARN, "%s [%u]: No dispatch callback set!\n",
-                __FUNCTION__, __LINE__);
-    }
-}
+// Event classes requested with hook_set_event_mask().
+static uint16_t event_mask = EVENT_MASK_ALL;
 
 // Set the native modifier mask for future events.
 static inline void set_modifier_mask(uint16_t mask) {
@@ -158,6 +205,14 @@ static void initialize_locks() {
         unset_modifier_mask(MASK_SCROLL_LOCK);
     }
     #else
+    // There is no server to ask when translating synthetic data.
+    if (hook->ctrl.display == NULL) {
+        return;
+    }
+
+    // Save the serial first so a change during the query is not missed.
+    hook->input.lock_serial = get_settings_serial(SETTINGS_INDICATOR_STATE);
+
     unsigned int led_mask = 0x00;
     if (XkbGetIndicatorState(hook->ctrl.display, XkbUseCoreKbd, &led_mask) == Success) {
         if (led_mask & 0x01) {
@@ -184,6 +239,26 @@ static void initialize_locks() {
     #endif
 }
 
+// Update the modifier lock masks after a key event without polling the server.
+static inline void update_locks(KeyCode keycode, unsigned short int scancode, bool is_pressed) {
+    #ifdef USE_XKB_COMMON
+    if (state != NULL) {
+        // The tracked xkb_state reports when the indicators have changed.
+        enum xkb_state_component changed = xkb_state_update_key(state, keycode, is_pressed ? XKB_KEY_DOWN : XKB_KEY_UP);
+        if (changed & XKB_STATE_LEDS) {
+            initialize_locks();
+        }
+    }
+    #else
+    // Lock keys are queried right away so their own event reflects the new
+    // state, any other change is picked up after an XkbIndicatorStateNotify.
+    if (scancode == VC_CAPS_LOCK || scancode == VC_NUM_LOCK || scancode == VC_SCROLL_LOCK
+            || hook->input.lock_serial != get_settings_serial(SETTINGS_INDICATOR_STATE)) {
+        initialize_locks();
+    }
+    #endif
+}
+
 // Initialize the modifier mask to the current modifiers.
 static void initialize_modifiers() {
     hook->input.mask = 0x0000;
@@ -251,542 +326,638 @@ static void initialize_modifiers() {
     initialize_locks();
 }
 
-void hook_event_proc(XPointer closeure, XRecordInterceptData *recorded_data) {
-    uint64_t timestamp = (uint64_t) recorded_data->server_time;
+// Refresh the cached multi-click interval.
+static void refresh_multi_click_time() {
+    // Save the serial first so a change during the refresh is not missed.
+    hook->input.mouse.click.serial = get_settings_serial(SETTINGS_RESOURCE_MANAGER);
+    hook->input.mouse.click.interval = x11_get_multi_click_time();
+}
 
-    if (recorded_data->category == XRecordStartOfData) {
-        // Initialize native input helper functions.
-        load_input_helper();
+// Get the multi-click interval, it is only resolved again after the X resources change.
+static inline long int get_multi_click_time() {
+    if (hook->input.mouse.click.serial != get_settings_serial(SETTINGS_RESOURCE_MANAGER)) {
+        refresh_multi_click_time();
+    }
 
-        // Populate the hook start event.
-        event.time = timestamp;
-        event.reserved = 0x00;
+    return hook->input.mouse.click.interval;
+}
 
-        event.type = EVENT_HOOK_ENABLED;
-        event.mask = 0x00;
+// Refresh the cached screen offset used to normalize mouse coordinates.
+static void refresh_screen_layout() {
+    // Save the serial first so a change during the refresh is not missed.
+    hook->screen.serial = get_settings_serial(SETTINGS_SCREEN_LAYOUT);
+    hook->screen.x = 0;
+    hook->screen.y = 0;
+
+    #if defined(USE_XINERAMA) || defined(USE_XRANDR)
+    uint8_t count;
+    screen_data *screens = x11_create_screen_info(&count);
+    if (screens != NULL) {
+        if (count > 1) {
+            hook->screen.x = screens[0].x;
+            hook->screen.y = screens[0].y;
+        }
 
-        // Fire the hook start event.
-        dispatch_event(&event);
-    } else if (recorded_data->category == XRecordEndOfData) {
-        // Populate the hook stop event.
-        event.time = timestamp;
-        event.reserved = 0x00;
+        free(screens);
+    }
+    #endif
 
-        event.type = EVENT_HOOK_DISABLED;
-        event.mask = 0x00;
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Screen offset set to %i, %i.\n",
+            __FUNCTION__, __LINE__, hook->screen.x, hook->screen.y);
+}
 
-        // Fire the hook stop event.
-        dispatch_event(&event);
+// Convert root window coordinates to coordinates relative to the first screen.
+static inline void normalize_coordinates(int16_t *x, int16_t *y) {
+    #if defined(USE_XINERAMA) || defined(USE_XRANDR)
+    if (hook->screen.serial != get_settings_serial(SETTINGS_SCREEN_LAYOUT)) {
+        refresh_screen_layout();
+    }
 
-        // Deinitialize native input helper functions.
-        unload_input_helper();
-    } else if (recorded_data->category == XRecordFromServer || recorded_data->category == XRecordFromClient) {
-        // Get XRecord data.
-        XRecordDatum *data = (XRecordDatum *) recorded_data->data;
+    *x -= hook->screen.x;
+    *y -= hook->screen.y;
+    #endif
+}
 
-        if (data->type == KeyPress) {
-            // The X11 KeyCode associated with this event.
-            KeyCode keycode = (KeyCode) data->event.u.u.detail;
-            KeySym keysym = 0x00;
-            #if defined(USE_XKB_COMMON)
-            if (state != NULL) {
-                keysym = xkb_state_key_get_one_sym(state, keycode);
-            }
-            #else
-            keysym = keycode_to_keysym(keycode, data->event.u.keyButtonPointer.state);
-            #endif
-
-            // Check to make sure the key is printable.
-            uint16_t buffer[2];
-            size_t count =  0;
-            #ifdef USE_XKB_COMMON
-            if (state != NULL) {
-                count = keycode_to_unicode(state, keycode, buffer, sizeof(buffer) / sizeof(uint16_t));
-            }
-            #else
-            count = keysym_to_unicode(keysym, buffer, sizeof(buffer) / sizeof(uint16_t));
-            #endif
-
-
-            unsigned short int scancode = keycode_to_scancode(keycode);
-
-            // TODO If you have a better suggestion for this ugly, let me know.
-            if      (scancode == VC_SHIFT_L)   { set_modifier_mask(MASK_SHIFT_L); }
-            else if (scancode == VC_SHIFT_R)   { set_modifier_mask(MASK_SHIFT_R); }
-            else if (scancode == VC_CONTROL_L) { set_modifier_mask(MASK_CTRL_L);  }
-            else if (scancode == VC_CONTROL_R) { set_modifier_mask(MASK_CTRL_R);  }
-            else if (scancode == VC_ALT_L)     { set_modifier_mask(MASK_ALT_L);   }
-            else if (scancode == VC_ALT_R)     { set_modifier_mask(MASK_ALT_R);   }
-            else if (scancode == VC_META_L)    { set_modifier_mask(MASK_META_L);  }
-            else if (scancode == VC_META_R)    { set_modifier_mask(MASK_META_R);  }
-            #ifdef USE_XKB_COMMON
-            xkb_state_update_key(state, keycode, XKB_KEY_DOWN);
-            #endif
-            initialize_locks();
+/* Stamp the input being processed with the monotonic clock and extend the
+ * 32-bit server time past its wrap around.  Passing CurrentTime only takes the
+ * receive time and returns the latest server time.
+ */
+static uint64_t receive_server_time(Time server_time) {
+    uint64_t now = stats_now();
+    hook->clock.receive_time = now;
 
+    uint64_t last = hook->clock.server_time;
+    if (server_time == CurrentTime) {
+        return last;
+    }
 
-            if ((get_modifiers() & MASK_NUM_LOCK) == 0) {
-                switch (scancode) {
-                    case VC_KP_SEPARATOR:
-                    case VC_KP_1:
-                    case VC_KP_2:
-                    case VC_KP_3:
-                    case VC_KP_4:
-                    case VC_KP_5:
-                    case VC_KP_6:
-                    case VC_KP_7:
-                    case VC_KP_8:
-                    case VC_KP_0:
-                    case VC_KP_9:
-                        scancode |= 0xEE00;
-                        break;
-                }
-            }
+    uint64_t time = (last & ~(uint64_t) UINT32_MAX) | (uint32_t) server_time;
+    if (last != 0) {
+        // Pick the 2^32 lap closest to the previous time.
+        if (time + INT32_MAX < last) {
+            time += (uint64_t) UINT32_MAX + 1;
+        } else if (time > last + INT32_MAX && time > UINT32_MAX) {
+            time -= (uint64_t) UINT32_MAX + 1;
+        }
+    }
 
-            // Populate key pressed event.
-            event.time = timestamp;
-            event.reserved = 0x00;
+    if (time > last) {
+        hook->clock.server_time = time;
+    }
 
-            event.type = EVENT_KEY_PRESSED;
-            event.mask = get_modifiers();
+    // The smallest offset has the least delivery delay in it.  Larger offsets
+    // are followed slowly so drift between the clocks is still tracked.
+    int64_t offset = (int64_t) now - (int64_t) (time * 1000000);
+    int64_t current = __atomic_load_n(&server_time_offset, __ATOMIC_RELAXED);
+    if (!__atomic_load_n(&is_server_time_mapped, __ATOMIC_RELAXED) || offset < current) {
+        __atomic_store_n(&server_time_offset, offset, __ATOMIC_RELAXED);
+        __atomic_store_n(&is_server_time_mapped, true, __ATOMIC_RELEASE);
+    } else {
+        __atomic_store_n(&server_time_offset, current + (offset - current) / 1024, __ATOMIC_RELAXED);
+    }
 
-            event.data.keyboard.keycode = scancode;
-            event.data.keyboard.rawcode = keysym;
-            event.data.keyboard.keychar = CHAR_UNDEFINED;
+    return time;
+}
 
-            logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X pressed. (%#X)\n",
-                    __FUNCTION__, __LINE__, event.data.keyboard.keycode, event.data.keyboard.rawcode);
+static void process_hook_enabled(uint64_t timestamp) {
+    // Initialize native input helper functions.
+    load_input_helper();
 
-            // Fire key pressed event.
-            dispatch_event(&event);
+    // Take the initial screen layout and multi-click snapshots.
+    refresh_screen_layout();
+    refresh_multi_click_time();
 
-            // If the pressed event was not consumed...
-            if (event.reserved ^ 0x01) {
-                for (unsigned int i = 0; i < count; i++) {
-                    // Populate key typed event.
-                    event.time = timestamp;
-                    event.reserved = 0x00;
+    // Populate the hook start event.
+    event.time = timestamp;
+    event.receive_time = hook->clock.receive_time;
+    event.reserved = 0x00;
 
-                    event.type = EVENT_KEY_TYPED;
-                    event.mask = get_modifiers();
+    event.type = EVENT_HOOK_ENABLED;
+    event.mask = 0x00;
 
-                    event.data.keyboard.keycode = VC_UNDEFINED;
-                    event.data.keyboard.rawcode = keysym;
-                    event.data.keyboard.keychar = buffer[i];
+    // Fire the hook start event.
+    dispatch_event(&event);
+}
 
-                    logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X typed. (%lc)\n",
-                            __FUNCTION__, __LINE__, event.data.keyboard.keycode, (uint16_t) event.data.keyboard.keychar);
+static void process_hook_disabled(uint64_t timestamp) {
+    // Populate the hook stop event.
+    event.time = timestamp;
+    event.receive_time = hook->clock.receive_time;
+    event.reserved = 0x00;
 
-                    // Fire key typed event.
-                    dispatch_event(&event);
-                }
-            }
-        } else if (data->type == KeyRelease) {
-            // The X11 KeyCode associated with this event.
-            KeyCode keycode = (KeyCode) data->event.u.u.detail;
-            KeySym keysym = 0x00;
-            #ifdef USE_XKB_COMMON
-            if (state != NULL) {
-                keysym = xkb_state_key_get_one_sym(state, keycode);
-            }
-            #else
-            keysym = keycode_to_keysym(keycode, data->event.u.keyButtonPointer.state);
-            #endif
-
-            // Check to make sure the key is printable.
-            uint16_t buffer[2];
-            #ifdef USE_XKB_COMMON
-            if (state != NULL) {
-                keycode_to_unicode(state, keycode, buffer, sizeof(buffer) / sizeof(uint16_t));
-            }
-            #else
-            keysym_to_unicode(keysym, buffer, sizeof(buffer) / sizeof(uint16_t));
-            #endif
-
-            unsigned short int scancode = keycode_to_scancode(keycode);
-
-            // TODO If you have a better suggestion for this ugly, let me know.
-            if      (scancode == VC_SHIFT_L)   { unset_modifier_mask(MASK_SHIFT_L); }
-            else if (scancode == VC_SHIFT_R)   { unset_modifier_mask(MASK_SHIFT_R); }
-            else if (scancode == VC_CONTROL_L) { unset_modifier_mask(MASK_CTRL_L);  }
-            else if (scancode == VC_CONTROL_R) { unset_modifier_mask(MASK_CTRL_R);  }
-            else if (scancode == VC_ALT_L)     { unset_modifier_mask(MASK_ALT_L);   }
-            else if (scancode == VC_ALT_R)     { unset_modifier_mask(MASK_ALT_R);   }
-            else if (scancode == VC_META_L)    { unset_modifier_mask(MASK_META_L);  }
-            else if (scancode == VC_META_R)    { unset_modifier_mask(MASK_META_R);  }
-            #ifdef USE_XKB_COMMON
-            xkb_state_update_key(state, keycode, XKB_KEY_UP);
-            #endif
-            initialize_locks();
+    event.type = EVENT_HOOK_DISABLED;
+    event.mask = 0x00;
 
-            if ((get_modifiers() & MASK_NUM_LOCK) == 0) {
-                switch (scancode) {
-                    case VC_KP_SEPARATOR:
-                    case VC_KP_1:
-                    case VC_KP_2:
-                    case VC_KP_3:
-                    case VC_KP_4:
-                    case VC_KP_5:
-                    case VC_KP_6:
-                    case VC_KP_7:
-                    case VC_KP_8:
-                    case VC_KP_0:
-                    case VC_KP_9:
-                        scancode |= 0xEE00;
-                        break;
-                }
-            }
+    // Fire the hook stop event.
+    dispatch_event(&event);
+
+    // Deinitialize native input helper functions.
+    unload_input_helper();
+}
+
+/* Swap in a keyboard layout rebuilt by the settings thread and announce it.
+ * Called before each batch of input is translated, the change is stamped
+ * with the time it was picked up.
+ */
+static void update_keyboard_layout() {
+    #ifdef USE_XKB_COMMON
+    struct xkb_state *next = update_xkb_state(state);
+    if (next == state) {
+        return;
+    }
+
+    state = next;
+    if (state != NULL) {
+        initialize_locks();
+    }
+    #else
+    if (!update_keyboard_map()) {
+        return;
+    }
+    #endif
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Keyboard layout changed.\n",
+            __FUNCTION__, __LINE__);
+
+    // Populate keyboard layout changed event.
+    event.time = receive_server_time(CurrentTime);
+    event.receive_time = hook->clock.receive_time;
+    event.reserved = 0x00;
 
-            // Populate key released event.
+    event.type = EVENT_KEYBOARD_LAYOUT_CHANGED;
+    event.mask = get_modifiers();
+
+    // Fire keyboard layout changed event.
+    dispatch_event(&event);
+}
+
+static void process_key_pressed(uint64_t timestamp, KeyCode keycode, unsigned int modifier_mask) {
+    // Lookup the key symbol and any printable characters.
+    key_translation translation;
+    #ifdef USE_XKB_COMMON
+    keycode_to_translation(state, keycode, &translation);
+    #else
+    keycode_to_translation(keycode, modifier_mask, &translation);
+    #endif
+    KeySym keysym = translation.keysym;
+    uint16_t *buffer = translation.unicode;
+    size_t count = translation.count;
+
+    unsigned short int scancode = keycode_to_scancode(keycode);
+
+    // TODO If you have a better suggestion for this ugly, let me know.
+    if      (scancode == VC_SHIFT_L)   { set_modifier_mask(MASK_SHIFT_L); }
+    else if (scancode == VC_SHIFT_R)   { set_modifier_mask(MASK_SHIFT_R); }
+    else if (scancode == VC_CONTROL_L) { set_modifier_mask(MASK_CTRL_L);  }
+    else if (scancode == VC_CONTROL_R) { set_modifier_mask(MASK_CTRL_R);  }
+    else if (scancode == VC_ALT_L)     { set_modifier_mask(MASK_ALT_L);   }
+    else if (scancode == VC_ALT_R)     { set_modifier_mask(MASK_ALT_R);   }
+    else if (scancode == VC_META_L)    { set_modifier_mask(MASK_META_L);  }
+    else if (scancode == VC_META_R)    { set_modifier_mask(MASK_META_R);  }
+    update_locks(keycode, scancode, true);
+
+
+    if ((get_modifiers() & MASK_NUM_LOCK) == 0) {
+        switch (scancode) {
+            case VC_KP_SEPARATOR:
+            case VC_KP_1:
+            case VC_KP_2:
+            case VC_KP_3:
+            case VC_KP_4:
+            case VC_KP_5:
+            case VC_KP_6:
+            case VC_KP_7:
+            case VC_KP_8:
+            case VC_KP_0:
+            case VC_KP_9:
+                scancode |= 0xEE00;
+                break;
+        }
+    }
+
+    // Populate key pressed event.
+    event.time = timestamp;
+    event.receive_time = hook->clock.receive_time;
+    event.reserved = 0x00;
+
+    event.type = EVENT_KEY_PRESSED;
+    event.mask = get_modifiers();
+
+    event.data.keyboard.keycode = scancode;
+    event.data.keyboard.rawcode = keysym;
+    event.data.keyboard.keychar = CHAR_UNDEFINED;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X pressed. (%#X)\n",
+            __FUNCTION__, __LINE__, event.data.keyboard.keycode, event.data.keyboard.rawcode);
+
+    // Fire key pressed event.
+    dispatch_event(&event);
+
+    // If the pressed event was not consumed...
+    if (event.reserved ^ 0x01) {
+        for (unsigned int i = 0; i < count; i++) {
+            // Populate key typed event.
             event.time = timestamp;
+            event.receive_time = hook->clock.receive_time;
             event.reserved = 0x00;
 
-            event.type = EVENT_KEY_RELEASED;
+            event.type = EVENT_KEY_TYPED;
             event.mask = get_modifiers();
 
-            event.data.keyboard.keycode = scancode;
+            event.data.keyboard.keycode = VC_UNDEFINED;
             event.data.keyboard.rawcode = keysym;
-            event.data.keyboard.keychar = CHAR_UNDEFINED;
+            event.data.keyboard.keychar = buffer[i];
 
-            logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X released. (%#X)\n",
-                    __FUNCTION__, __LINE__, event.data.keyboard.keycode, event.data.keyboard.rawcode);
+            logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X typed. (%lc)\n",
+                    __FUNCTION__, __LINE__, event.data.keyboard.keycode, (uint16_t) event.data.keyboard.keychar);
 
-            // Fire key released event.
+            // Fire key typed event.
             dispatch_event(&event);
-        } else if (data->type == ButtonPress) {
-            unsigned int map_button = button_map_lookup(data->event.u.u.detail);
-
-            // X11 handles wheel events as button events.
-            if (map_button == WheelUp || map_button == WheelDown
-                    || map_button == WheelLeft || map_button == WheelRight) {
-
-                // Reset the click count and previous button.
-                hook->input.mouse.click.count = 1;
-                hook->input.mouse.click.button = MOUSE_NOBUTTON;
-
-                /* Scroll wheel release events.
-                 * Scroll type: WHEEL_UNIT_SCROLL
-                 * Scroll amount: 3 unit increments per notch
-                 * Units to scroll: 3 unit increments
-                 * Vertical unit increment: 15 pixels
-                 */
-
-                // Populate mouse wheel event.
-                event.time = timestamp;
-                event.reserved = 0x00;
-
-                event.type = EVENT_MOUSE_WHEEL;
-                event.mask = get_modifiers();
-
-                event.data.wheel.clicks = hook->input.mouse.click.count;
-                event.data.wheel.x = data->event.u.keyButtonPointer.rootX;
-                event.data.wheel.y = data->event.u.keyButtonPointer.rootY;
-
-                #if defined(USE_XINERAMA) || defined(USE_XRANDR)
-                uint8_t count;
-                screen_data *screens = hook_create_screen_info(&count);
-                if (count > 1) {
-                    event.data.wheel.x -= screens[0].x;
-                    event.data.wheel.y -= screens[0].y;
-                }
+        }
+    }
+}
 
-                if (screens != NULL) {
-                    free(screens);
-                }
-                #endif
-
-                /* X11 does not have an API call for acquiring the mouse scroll type.  This
-                 * maybe part of the XInput2 (XI2) extention but I will wont know until it
-                 * is available on my platform.  For the time being we will just use the
-                 * unit scroll value.
-                 */
-                event.data.wheel.type = WHEEL_UNIT_SCROLL;
-
-                /* Some scroll wheel properties are available via the new XInput2 (XI2)
-                 * extension.  Unfortunately the extension is not available on my
-                 * development platform at this time.  For the time being we will just
-                 * use the Windows default value of 3.
-                 */
-                event.data.wheel.amount = 3;
-
-                if (data->event.u.u.detail == WheelUp || data->event.u.u.detail == WheelLeft) {
-                    // Wheel Rotated Up and Away.
-                    event.data.wheel.rotation = -1;
-                } else { // data->event.u.u.detail == WheelDown
-                    // Wheel Rotated Down and Towards.
-                    event.data.wheel.rotation = 1;
-                }
+static void process_key_released(uint64_t timestamp, KeyCode keycode, unsigned int modifier_mask) {
+    // Lookup the key symbol, the released key does not type characters.
+    key_translation translation;
+    #ifdef USE_XKB_COMMON
+    keycode_to_translation(state, keycode, &translation);
+    #else
+    keycode_to_translation(keycode, modifier_mask, &translation);
+    #endif
+    KeySym keysym = translation.keysym;
+
+    unsigned short int scancode = keycode_to_scancode(keycode);
+
+    // TODO If you have a better suggestion for this ugly, let me know.
+    if      (scancode == VC_SHIFT_L)   { unset_modifier_mask(MASK_SHIFT_L); }
+    else if (scancode == VC_SHIFT_R)   { unset_modifier_mask(MASK_SHIFT_R); }
+    else if (scancode == VC_CONTROL_L) { unset_modifier_mask(MASK_CTRL_L);  }
+    else if (scancode == VC_CONTROL_R) { unset_modifier_mask(MASK_CTRL_R);  }
+    else if (scancode == VC_ALT_L)     { unset_modifier_mask(MASK_ALT_L);   }
+    else if (scancode == VC_ALT_R)     { unset_modifier_mask(MASK_ALT_R);   }
+    else if (scancode == VC_META_L)    { unset_modifier_mask(MASK_META_L);  }
+    else if (scancode == VC_META_R)    { unset_modifier_mask(MASK_META_R);  }
+    update_locks(keycode, scancode, false);
+
+    if ((get_modifiers() & MASK_NUM_LOCK) == 0) {
+        switch (scancode) {
+            case VC_KP_SEPARATOR:
+            case VC_KP_1:
+            case VC_KP_2:
+            case VC_KP_3:
+            case VC_KP_4:
+            case VC_KP_5:
+            case VC_KP_6:
+            case VC_KP_7:
+            case VC_KP_8:
+            case VC_KP_0:
+            case VC_KP_9:
+                scancode |= 0xEE00;
+                break;
+        }
+    }
 
-                if (data->event.u.u.detail == WheelUp || data->event.u.u.detail == WheelDown) {
-                    // Wheel Rotated Up or Down.
-                    event.data.wheel.direction = WHEEL_VERTICAL_DIRECTION;
-                } else { // data->event.u.u.detail == WheelLeft || data->event.u.u.detail == WheelRight
-                    // Wheel Rotated Left or Right.
-                    event.data.wheel.direction = WHEEL_HORIZONTAL_DIRECTION;
-                }
+    // Populate key released event.
+    event.time = timestamp;
+    event.receive_time = hook->clock.receive_time;
+    event.reserved = 0x00;
 
-                logger(LOG_LEVEL_DEBUG, "%s [%u]: Mouse wheel type %u, rotated %i units in the %u direction at %u, %u.\n",
-                        __FUNCTION__, __LINE__, event.data.wheel.type,
-                        event.data.wheel.amount * event.data.wheel.rotation,
-                        event.data.wheel.direction,
-                        event.data.wheel.x, event.data.wheel.y);
+    event.type = EVENT_KEY_RELEASED;
+    event.mask = get_modifiers();
 
-                // Fire mouse wheel event.
-                dispatch_event(&event);
-            } else {
-                /* This information is all static for X11, its up to the WM to
-                 * decide how to interpret the wheel events.
-                 */
-                uint16_t button = MOUSE_NOBUTTON;
-                switch (map_button) {
-                    case Button1:
-                        button = MOUSE_BUTTON1;
-                        set_modifier_mask(MASK_BUTTON1);
-                        break;
-
-                    case Button2:
-                        button = MOUSE_BUTTON2;
-                        set_modifier_mask(MASK_BUTTON2);
-                        break;
-
-                    case Button3:
-                        button = MOUSE_BUTTON3;
-                        set_modifier_mask(MASK_BUTTON3);
-                        break;
-
-                    case XButton1:
-                        button = MOUSE_BUTTON4;
-                        set_modifier_mask(MASK_BUTTON5);
-                        break;
-
-                    case XButton2:
-                        button = MOUSE_BUTTON5;
-                        set_modifier_mask(MASK_BUTTON5);
-                        break;
-
-                    default:
-                        // Do not set modifier masks past button MASK_BUTTON5.
-                        break;
-                }
+    event.data.keyboard.keycode = scancode;
+    event.data.keyboard.rawcode = keysym;
+    event.data.keyboard.keychar = CHAR_UNDEFINED;
 
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Key %#X released. (%#X)\n",
+            __FUNCTION__, __LINE__, event.data.keyboard.keycode, event.data.keyboard.rawcode);
 
-                // Track the number of clicks, the button must match the previous button.
-                if (button == hook->input.mouse.click.button && (long int) (timestamp - hook->input.mouse.click.time) <= hook_get_multi_click_time()) {
-                    if (hook->input.mouse.click.count < USHRT_MAX) {
-                        hook->input.mouse.click.count++;
-                    } else {
-                        logger(LOG_LEVEL_WARN, "%s [%u]: Click count overflow detected!\n",
-                                __FUNCTION__, __LINE__);
-                    }
-                } else {
-                    // Reset the click count.
-                    hook->input.mouse.click.count = 1;
+    // Fire key released event.
+    dispatch_event(&event);
+}
 
-                    // Set the previous button.
-                    hook->input.mouse.click.button = button;
-                }
+static void process_button_pressed(uint64_t timestamp, unsigned int detail, int16_t x, int16_t y) {
+    unsigned int map_button = button_map_lookup(detail);
 
-                // Save this events time to calculate the hook->input.mouse.click.count.
-                hook->input.mouse.click.time = timestamp;
+    // X11 handles wheel events as button events.
+    if (map_button == WheelUp || map_button == WheelDown
+            || map_button == WheelLeft || map_button == WheelRight) {
 
+        // Reset the click count and previous button.
+        hook->input.mouse.click.count = 1;
+        hook->input.mouse.click.button = MOUSE_NOBUTTON;
 
-                // Populate mouse pressed event.
-                event.time = timestamp;
-                event.reserved = 0x00;
+        /* Scroll wheel release events.
+         * Scroll type: WHEEL_UNIT_SCROLL
+         * Scroll amount: 3 unit increments per notch
+         * Units to scroll: 3 unit increments
+         * Vertical unit increment: 15 pixels
+         */
 
-                event.type = EVENT_MOUSE_PRESSED;
-                event.mask = get_modifiers();
+        // Populate mouse wheel event.
+        event.time = timestamp;
+        event.receive_time = hook->clock.receive_time;
+        event.reserved = 0x00;
 
-                event.data.mouse.button = button;
-                event.data.mouse.clicks = hook->input.mouse.click.count;
-                event.data.mouse.x = data->event.u.keyButtonPointer.rootX;
-                event.data.mouse.y = data->event.u.keyButtonPointer.rootY;
+        event.type = EVENT_MOUSE_WHEEL;
+        event.mask = get_modifiers();
+
+        event.data.wheel.clicks = hook->input.mouse.click.count;
+        event.data.wheel.x = x;
+        event.data.wheel.y = y;
+
+        normalize_coordinates(&event.data.wheel.x, &event.data.wheel.y);
+
+        /* X11 does not have an API call for acquiring the mouse scroll type.  This
+         * maybe part of the XInput2 (XI2) extention but I will wont know until it
+         * is available on my platform.  For the time being we will just use the
+         * unit scroll value.
+         */
+        event.data.wheel.type = WHEEL_UNIT_SCROLL;
+
+        /* Some scroll wheel properties are available via the new XInput2 (XI2)
+         * extension.  Unfortunately the extension is not available on my
+         * development platform at this time.  For the time being we will just
+         * use the Windows default value of 3.
+         */
+        event.data.wheel.amount = 3;
+
+        if (detail == WheelUp || detail == WheelLeft) {
+            // Wheel Rotated Up and Away.
+            event.data.wheel.rotation = -1;
+        } else { // detail == WheelDown
+            // Wheel Rotated Down and Towards.
+            event.data.wheel.rotation = 1;
+        }
 
-                #if defined(USE_XINERAMA) || defined(USE_XRANDR)
-                uint8_t count;
-                screen_data *screens = hook_create_screen_info(&count);
-                if (count > 1) {
-                    event.data.mouse.x -= screens[0].x;
-                    event.data.mouse.y -= screens[0].y;
-                }
+        if (detail == WheelUp || detail == WheelDown) {
+            // Wheel Rotated Up or Down.
+            event.data.wheel.direction = WHEEL_VERTICAL_DIRECTION;
+        } else { // detail == WheelLeft || detail == WheelRight
+            // Wheel Rotated Left or Right.
+            event.data.wheel.direction = WHEEL_HORIZONTAL_DIRECTION;
+        }
 
-                if (screens != NULL) {
-                    free(screens);
-                }
-                #endif
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Mouse wheel type %u, rotated %i units in the %u direction at %u, %u.\n",
+                __FUNCTION__, __LINE__, event.data.wheel.type,
+                event.data.wheel.amount * event.data.wheel.rotation,
+                event.data.wheel.direction,
+                event.data.wheel.x, event.data.wheel.y);
+
+        // Fire mouse wheel event.
+        dispatch_event(&event);
+    } else {
+        /* This information is all static for X11, its up to the WM to
+         * decide how to interpret the wheel events.
+         */
+        uint16_t button = MOUSE_NOBUTTON;
+        switch (map_button) {
+            case Button1:
+                button = MOUSE_BUTTON1;
+                set_modifier_mask(MASK_BUTTON1);
+                break;
+
+            case Button2:
+                button = MOUSE_BUTTON2;
+                set_modifier_mask(MASK_BUTTON2);
+                break;
+
+            case Button3:
+                button = MOUSE_BUTTON3;
+                set_modifier_mask(MASK_BUTTON3);
+                break;
+
+            case XButton1:
+                button = MOUSE_BUTTON4;
+                set_modifier_mask(MASK_BUTTON5);
+                break;
+
+            case XButton2:
+                button = MOUSE_BUTTON5;
+                set_modifier_mask(MASK_BUTTON5);
+                break;
+
+            default:
+                // Do not set modifier masks past button MASK_BUTTON5.
+                break;
+        }
 
-                logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u  pressed %u time(s). (%u, %u)\n",
-                        __FUNCTION__, __LINE__, event.data.mouse.button, event.data.mouse.clicks,
-                        event.data.mouse.x, event.data.mouse.y);
 
-                // Fire mouse pressed event.
-                dispatch_event(&event);
+        // Track the number of clicks, the button must match the previous button.
+        if (button == hook->input.mouse.click.button && (long int) (timestamp - hook->input.mouse.click.time) <= get_multi_click_time()) {
+            if (hook->input.mouse.click.count < USHRT_MAX) {
+                hook->input.mouse.click.count++;
+            } else {
+                logger(LOG_LEVEL_WARN, "%s [%u]: Click count overflow detected!\n",
+                        __FUNCTION__, __LINE__);
             }
-        } else if (data->type == ButtonRelease) {
-            unsigned int map_button = button_map_lookup(data->event.u.u.detail);
-
-            // X11 handles wheel events as button events.
-            if (map_button != WheelUp && map_button != WheelDown
-                    && map_button != WheelLeft && map_button != WheelRight) {
-
-                /* This information is all static for X11, its up to the WM to
-                 * decide how to interpret the wheel events.
-                 */
-                uint16_t button = MOUSE_NOBUTTON;
-                switch (map_button) {
-                    // FIXME This should use a lookup table to handle button remapping.
-                    case Button1:
-                        button = MOUSE_BUTTON1;
-                        unset_modifier_mask(MASK_BUTTON1);
-                        break;
-
-                    case Button2:
-                        button = MOUSE_BUTTON2;
-                        unset_modifier_mask(MASK_BUTTON2);
-                        break;
-
-                    case Button3:
-                        button = MOUSE_BUTTON3;
-                        unset_modifier_mask(MASK_BUTTON3);
-                        break;
-
-                    case XButton1:
-                        button = MOUSE_BUTTON4;
-                        unset_modifier_mask(MASK_BUTTON5);
-                        break;
-
-                    case XButton2:
-                        button = MOUSE_BUTTON5;
-                        unset_modifier_mask(MASK_BUTTON5);
-                        break;
-
-                    default:
-                        // Do not set modifier masks past button MASK_BUTTON5.
-                        break;
-                }
+        } else {
+            // Reset the click count.
+            hook->input.mouse.click.count = 1;
 
-                // Populate mouse released event.
-                event.time = timestamp;
-                event.reserved = 0x00;
+            // Set the previous button.
+            hook->input.mouse.click.button = button;
+        }
 
-                event.type = EVENT_MOUSE_RELEASED;
-                event.mask = get_modifiers();
+        // Save this events time to calculate the hook->input.mouse.click.count.
+        hook->input.mouse.click.time = timestamp;
 
-                event.data.mouse.button = button;
-                event.data.mouse.clicks = hook->input.mouse.click.count;
-                event.data.mouse.x = data->event.u.keyButtonPointer.rootX;
-                event.data.mouse.y = data->event.u.keyButtonPointer.rootY;
 
-                #if defined(USE_XINERAMA) || defined(USE_XRANDR)
-                uint8_t count;
-                screen_data *screens = hook_create_screen_info(&count);
-                if (count > 1) {
-                    event.data.mouse.x -= screens[0].x;
-                    event.data.mouse.y -= screens[0].y;
-                }
+        // Populate mouse pressed event.
+        event.time = timestamp;
+        event.receive_time = hook->clock.receive_time;
+        event.reserved = 0x00;
 
-                if (screens != NULL) {
-                    free(screens);
-                }
-                #endif
-
-                logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u released %u time(s). (%u, %u)\n",
-                        __FUNCTION__, __LINE__, event.data.mouse.button,
-                        event.data.mouse.clicks,
-                        event.data.mouse.x, event.data.mouse.y);
-
-                // Fire mouse released event.
-                dispatch_event(&event);
-
-                // If the pressed event was not consumed...
-                if (event.reserved ^ 0x01 && hook->input.mouse.is_dragged != true) {
-                    // Populate mouse clicked event.
-                    event.time = timestamp;
-                    event.reserved = 0x00;
-
-                    event.type = EVENT_MOUSE_CLICKED;
-                    event.mask = get_modifiers();
-
-                    event.data.mouse.button = button;
-                    event.data.mouse.clicks = hook->input.mouse.click.count;
-                    event.data.mouse.x = data->event.u.keyButtonPointer.rootX;
-                    event.data.mouse.y = data->event.u.keyButtonPointer.rootY;
-
-                    #if defined(USE_XINERAMA) || defined(USE_XRANDR)
-                    uint8_t count;
-                    screen_data *screens = hook_create_screen_info(&count);
-                    if (count > 1) {
-                        event.data.mouse.x -= screens[0].x;
-                        event.data.mouse.y -= screens[0].y;
-                    }
+        event.type = EVENT_MOUSE_PRESSED;
+        event.mask = get_modifiers();
 
-                    if (screens != NULL) {
-                        free(screens);
-                    }
-                    #endif
+        event.data.mouse.button = button;
+        event.data.mouse.clicks = hook->input.mouse.click.count;
+        event.data.mouse.x = x;
+        event.data.mouse.y = y;
 
-                    logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u clicked %u time(s). (%u, %u)\n",
-                            __FUNCTION__, __LINE__, event.data.mouse.button,
-                            event.data.mouse.clicks,
-                            event.data.mouse.x, event.data.mouse.y);
+        normalize_coordinates(&event.data.mouse.x, &event.data.mouse.y);
 
-                    // Fire mouse clicked event.
-                    dispatch_event(&event);
-                }
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u  pressed %u time(s). (%u, %u)\n",
+                __FUNCTION__, __LINE__, event.data.mouse.button, event.data.mouse.clicks,
+                event.data.mouse.x, event.data.mouse.y);
 
-                // Reset the number of clicks.
-                if (button == hook->input.mouse.click.button && (long int) (event.time - hook->input.mouse.click.time) > hook_get_multi_click_time()) {
-                    // Reset the click count.
-                    hook->input.mouse.click.count = 0;
-                }
-            }
-        } else if (data->type == MotionNotify) {
-            // Reset the click count.
-            if (hook->input.mouse.click.count != 0 && (long int) (timestamp - hook->input.mouse.click.time) > hook_get_multi_click_time()) {
-                hook->input.mouse.click.count = 0;
-            }
-            
-            // Populate mouse move event.
+        // Fire mouse pressed event.
+        dispatch_event(&event);
+    }
+}
+
+static void process_button_released(uint64_t timestamp, unsigned int detail, int16_t x, int16_t y) {
+    unsigned int map_button = button_map_lookup(detail);
+
+    // X11 handles wheel events as button events.
+    if (map_button != WheelUp && map_button != WheelDown
+            && map_button != WheelLeft && map_button != WheelRight) {
+
+        /* This information is all static for X11, its up to the WM to
+         * decide how to interpret the wheel events.
+         */
+        uint16_t button = MOUSE_NOBUTTON;
+        switch (map_button) {
+            // FIXME This should use a lookup table to handle button remapping.
+            case Button1:
+                button = MOUSE_BUTTON1;
+                unset_modifier_mask(MASK_BUTTON1);
+                break;
+
+            case Button2:
+                button = MOUSE_BUTTON2;
+                unset_modifier_mask(MASK_BUTTON2);
+                break;
+
+            case Button3:
+                button = MOUSE_BUTTON3;
+                unset_modifier_mask(MASK_BUTTON3);
+                break;
+
+            case XButton1:
+                button = MOUSE_BUTTON4;
+                unset_modifier_mask(MASK_BUTTON5);
+                break;
+
+            case XButton2:
+                button = MOUSE_BUTTON5;
+                unset_modifier_mask(MASK_BUTTON5);
+                break;
+
+            default:
+                // Do not set modifier masks past button MASK_BUTTON5.
+                break;
+        }
+
+        // Populate mouse released event.
+        event.time = timestamp;
+        event.receive_time = hook->clock.receive_time;
+        event.reserved = 0x00;
+
+        event.type = EVENT_MOUSE_RELEASED;
+        event.mask = get_modifiers();
+
+        event.data.mouse.button = button;
+        event.data.mouse.clicks = hook->input.mouse.click.count;
+        event.data.mouse.x = x;
+        event.data.mouse.y = y;
+
+        normalize_coordinates(&event.data.mouse.x, &event.data.mouse.y);
+
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u released %u time(s). (%u, %u)\n",
+                __FUNCTION__, __LINE__, event.data.mouse.button,
+                event.data.mouse.clicks,
+                event.data.mouse.x, event.data.mouse.y);
+
+        // Fire mouse released event.
+        dispatch_event(&event);
+
+        // If the pressed event was not consumed...
+        if (event.reserved ^ 0x01 && hook->input.mouse.is_dragged != true) {
+            // Populate mouse clicked event.
             event.time = timestamp;
+            event.receive_time = hook->clock.receive_time;
             event.reserved = 0x00;
 
+            event.type = EVENT_MOUSE_CLICKED;
             event.mask = get_modifiers();
 
-            // Check the upper half of virtual modifiers for non-zero values and set the mouse
-            // dragged flag.  The last 3 bits are reserved for lock masks.
-            hook->input.mouse.is_dragged = ((event.mask & 0x1F00) > 0);
-            if (hook->input.mouse.is_dragged) {
-                // Create Mouse Dragged event.
-                event.type = EVENT_MOUSE_DRAGGED;
-            } else {
-                // Create a Mouse Moved event.
-                event.type = EVENT_MOUSE_MOVED;
-            }
-
-            event.data.mouse.button = MOUSE_NOBUTTON;
+            event.data.mouse.button = button;
             event.data.mouse.clicks = hook->input.mouse.click.count;
-            event.data.mouse.x = data->event.u.keyButtonPointer.rootX;
-            event.data.mouse.y = data->event.u.keyButtonPointer.rootY;
-
-            #if defined(USE_XINERAMA) || defined(USE_XRANDR)
-            uint8_t count;
-            screen_data *screens = hook_create_screen_info(&count);
-            if (count > 1) {
-                event.data.mouse.x -= screens[0].x;
-                event.data.mouse.y -= screens[0].y;
-            }
+            event.data.mouse.x = x;
+            event.data.mouse.y = y;
 
-            if (screens != NULL) {
-                free(screens);
-            }
-            #endif
+            normalize_coordinates(&event.data.mouse.x, &event.data.mouse.y);
 
-            logger(LOG_LEVEL_DEBUG, "%s [%u]: Mouse %s to %i, %i. (%#X)\n",
-                    __FUNCTION__, __LINE__, hook->input.mouse.is_dragged ? "dragged" : "moved",
-                    event.data.mouse.x, event.data.mouse.y, event.mask);
+            logger(LOG_LEVEL_DEBUG, "%s [%u]: Button %u clicked %u time(s). (%u, %u)\n",
+                    __FUNCTION__, __LINE__, event.data.mouse.button,
+                    event.data.mouse.clicks,
+                    event.data.mouse.x, event.data.mouse.y);
 
-            // Fire mouse move event.
+            // Fire mouse clicked event.
             dispatch_event(&event);
+        }
+
+        // Reset the number of clicks.
+        if (button == hook->input.mouse.click.button && (long int) (event.time - hook->input.mouse.click.time) > get_multi_click_time()) {
+            // Reset the click count.
+            hook->input.mouse.click.count = 0;
+        }
+    }
+}
+
+static void process_mouse_moved(uint64_t timestamp, int16_t x, int16_t y) {
+    // Reset the click count.
+    if (hook->input.mouse.click.count != 0 && (long int) (timestamp - hook->input.mouse.click.time) > get_multi_click_time()) {
+        hook->input.mouse.click.count = 0;
+    }
+    
+    // Populate mouse move event.
+    event.time = timestamp;
+    event.receive_time = hook->clock.receive_time;
+    event.reserved = 0x00;
+
+    event.mask = get_modifiers();
+
+    // Check the upper half of virtual modifiers for non-zero values and set the mouse
+    // dragged flag.  The last 3 bits are reserved for lock masks.
+    hook->input.mouse.is_dragged = ((event.mask & 0x1F00) > 0);
+    if (hook->input.mouse.is_dragged) {
+        // Create Mouse Dragged event.
+        event.type = EVENT_MOUSE_DRAGGED;
+    } else {
+        // Create a Mouse Moved event.
+        event.type = EVENT_MOUSE_MOVED;
+    }
+
+    event.data.mouse.button = MOUSE_NOBUTTON;
+    event.data.mouse.clicks = hook->input.mouse.click.count;
+    event.data.mouse.x = x;
+    event.data.mouse.y = y;
+
+    normalize_coordinates(&event.data.mouse.x, &event.data.mouse.y);
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Mouse %s to %i, %i. (%#X)\n",
+            __FUNCTION__, __LINE__, hook->input.mouse.is_dragged ? "dragged" : "moved",
+            event.data.mouse.x, event.data.mouse.y, event.mask);
+
+    // Fire mouse move event.
+    dispatch_event(&event);
+}
+
+// Translate one XRecord reply into events.
+static void process_recorded_data(XRecordInterceptData *recorded_data) {
+    if (recorded_data->category == XRecordFromServer || recorded_data->category == XRecordFromClient) {
+        update_keyboard_layout();
+    }
+
+    uint64_t timestamp = receive_server_time(recorded_data->server_time);
+
+    stats_begin_translation(hook->clock.receive_time);
+
+    if (recorded_data->category == XRecordStartOfData) {
+        process_hook_enabled(timestamp);
+    } else if (recorded_data->category == XRecordEndOfData) {
+        process_hook_disabled(timestamp);
+    } else if (recorded_data->category == XRecordFromServer || recorded_data->category == XRecordFromClient) {
+        // Get XRecord data.
+        XRecordDatum *data = (XRecordDatum *) recorded_data->data;
+        stats_record_server_time((uint32_t) recorded_data->server_time, hook->clock.receive_time);
+
+        if (data->type == KeyPress) {
+            process_key_pressed(timestamp, (KeyCode) data->event.u.u.detail, data->event.u.keyButtonPointer.state);
+        } else if (data->type == KeyRelease) {
+            process_key_released(timestamp, (KeyCode) data->event.u.u.detail, data->event.u.keyButtonPointer.state);
+        } else if (data->type == ButtonPress) {
+            process_button_pressed(timestamp, data->event.u.u.detail,
+                    data->event.u.keyButtonPointer.rootX, data->event.u.keyButtonPointer.rootY);
+        } else if (data->type == ButtonRelease) {
+            process_button_released(timestamp, data->event.u.u.detail,
+                    data->event.u.keyButtonPointer.rootX, data->event.u.keyButtonPointer.rootY);
+        } else if (data->type == MotionNotify) {
+            process_mouse_moved(timestamp, data->event.u.keyButtonPointer.rootX, data->event.u.keyButtonPointer.rootY);
         } else {
             // In theory this *should* never execute.
             logger(LOG_LEVEL_DEBUG, "%s [%u]: Unhandled X11 event: %#X.\n",
@@ -797,8 +968,19 @@ void hook_event_proc(XPointer closeure, XRecordInterceptData *recorded_data) {
                 __FUNCTION__, __LINE__, recorded_data->category);
     }
 
+    stats_end_translation();
+
     // TODO There is no way to consume the XRecord event.
 
+    // Each XRecord reply is delivered separately in synchronous mode.
+    if (!hook->data.is_async) {
+        flush_dispatch_batch();
+    }
+}
+
+void hook_event_proc(XPointer closeure, XRecordInterceptData *recorded_data) {
+    process_recorded_data(recorded_data);
+
     XRecordFreeData(recorded_data);
 }
 
@@ -815,6 +997,65 @@ static inline bool enable_key_repeate() {
 }
 
 
+// Run the callbacks for every reply Xlib can read without blocking.
+static inline void xrecord_process_replies() {
+    XRecordProcessReplies(hook->data.display);
+
+    // Everything read in one pass is delivered as a single batch.
+    flush_dispatch_batch();
+}
+
+#if defined(USE_XRECORD_ASYNC) || defined(USE_XINPUT2)
+static int stop_pipe_open() {
+    if (pipe(stop_pipe) != 0) {
+        return -1;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        fcntl(stop_pipe[i], F_SETFD, FD_CLOEXEC);
+        fcntl(stop_pipe[i], F_SETFL, O_NONBLOCK);
+    }
+
+    return 0;
+}
+
+// Wake the loop blocked in poll() with one of the WAKE_* commands.
+static void stop_pipe_wake(char command) {
+    if (stop_pipe[1] != -1) {
+        if (write(stop_pipe[1], &command, 1) < 0) {
+            logger(LOG_LEVEL_WARN, "%s [%u]: Failed to wake the hook loop! (%i)\n",
+                    __FUNCTION__, __LINE__, errno);
+        }
+    }
+}
+
+// Drain the pending commands, returns true if hook_stop() was called.
+static bool stop_pipe_read() {
+    bool is_stopped = false;
+
+    char commands[16];
+    ssize_t count;
+    while ((count = read(stop_pipe[0], commands, sizeof(commands))) > 0) {
+        for (ssize_t i = 0; i < count; i++) {
+            if (commands[i] == WAKE_STOP) {
+                is_stopped = true;
+            }
+        }
+    }
+
+    return is_stopped;
+}
+
+static void stop_pipe_close() {
+    for (int i = 0; i < 2; i++) {
+        if (stop_pipe[i] != -1) {
+            close(stop_pipe[i]);
+            stop_pipe[i] = -1;
+        }
+    }
+}
+#endif
+
 static inline int xrecord_block() {
     int status = UIOHOOK_FAILURE;
 
@@ -823,40 +1064,54 @@ static inline int xrecord_block() {
     XPointer closeure = NULL;
 
     #ifdef USE_XRECORD_ASYNC
-    // Async requires that we loop so that our thread does not return.
-    if (XRecordEnableContextAsync(hook->data.display, context, hook_event_proc, closeure) != 0) {
-        // Time in MS to sleep the runloop.
-        int timesleep = 100;
+    if (stop_pipe_open() != 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create the stop pipe! (%i)\n",
+                __FUNCTION__, __LINE__, errno);
+
+        return UIOHOOK_FAILURE;
+    }
 
-        // Allow the thread loop to block.
-        pthread_mutex_lock(&hook_xrecord_mutex);
-        running = true;
+    // Async requires that we loop so that our thread does not return.
+    hook->data.is_async = true;
+    if (XRecordEnableContextAsync(hook->data.display, hook->ctrl.context, hook_event_proc, closeure) != 0) {
+        // Sleep until the X server sends data or hook_stop() is called, there
+        // are no timed wake ups while idle.
+        struct pollfd fds[2] = {
+            { .fd = ConnectionNumber(hook->data.display), .events = POLLIN },
+            { .fd = stop_pipe[0], .events = POLLIN }
+        };
 
+        status = UIOHOOK_SUCCESS;
         do {
-            // Unlock the mutex from the previous iteration.
-            pthread_mutex_unlock(&hook_xrecord_mutex);
+            // Xlib may have already buffered replies while enabling the context.
+            xrecord_process_replies();
 
-            XRecordProcessReplies(hook->data.display);
+            if (poll(fds, 2, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
 
-            // Prevent 100% CPU utilization.
-            struct timeval tv;
-            gettimeofday(&tv, NULL);
+                logger(LOG_LEVEL_ERROR, "%s [%u]: poll failure! (%i)\n",
+                        __FUNCTION__, __LINE__, errno);
 
-            struct timespec ts;
-            ts.tv_sec = time(NULL) + timesleep / 1000;
-            ts.tv_nsec = tv.tv_usec * 1000 + 1000 * 1000 * (timesleep % 1000);
-            ts.tv_sec += ts.tv_nsec / (1000 * 1000 * 1000);
-            ts.tv_nsec %= (1000 * 1000 * 1000);
+                status = UIOHOOK_FAILURE;
+                break;
+            }
 
-            pthread_mutex_lock(&hook_xrecord_mutex);
-            pthread_cond_timedwait(&hook_xrecord_cond, &hook_xrecord_mutex, &ts);
-        } while (running);
+            if (fds[0].revents & (POLLERR | POLLHUP)) {
+                logger(LOG_LEVEL_ERROR, "%s [%u]: Lost the XRecord data connection!\n",
+                        __FUNCTION__, __LINE__);
 
-        // Unlock after loop exit.
-        pthread_mutex_unlock(&hook_xrecord_mutex);
+                status = UIOHOOK_FAILURE;
+                break;
+            }
+        } while (!((fds[1].revents & POLLIN) && stop_pipe_read()));
 
-        // Set the exit status.
-        status = NULL;
+        // hook_stop() syncs the disable request before waking us, so this
+        // delivers the end of data and anything recorded before it.
+        if (status == UIOHOOK_SUCCESS) {
+            xrecord_process_replies();
+        }
     }
     #else
     // Sync blocks until XRecordDisableContext() is called.
@@ -868,20 +1123,74 @@ static inline int xrecord_block() {
         logger(LOG_LEVEL_ERROR, "%s [%u]: XRecordEnableContext failure!\n",
             __FUNCTION__, __LINE__);
 
-        #ifdef USE_XRECORD_ASYNC
-        // Reset the running state.
-        pthread_mutex_lock(&hook_xrecord_mutex);
-        running = false;
-        pthread_mutex_unlock(&hook_xrecord_mutex);
-        #endif
-
         // Set the exit status.
         status = UIOHOOK_ERROR_X_RECORD_ENABLE_CONTEXT;
     }
 
+    #ifdef USE_XRECORD_ASYNC
+    stop_pipe_close();
+    #endif
+
     return status;
 }
 
+// Returns true if the X11 device event type belongs to a class in the mask.
+static inline bool is_event_type_selected(uint16_t mask, int type) {
+    switch (type) {
+        case KeyPress:
+        case KeyRelease:
+            return (mask & EVENT_MASK_KEYBOARD) != 0;
+
+        case ButtonPress:
+        case ButtonRelease:
+            return (mask & EVENT_MASK_MOUSE_BUTTON) != 0;
+
+        case MotionNotify:
+            return (mask & EVENT_MASK_MOUSE_MOTION) != 0;
+    }
+
+    return false;
+}
+
+/* Allocate one XRecord range for each contiguous run of selected device
+ * events so unselected events are never transferred from the server.  Returns
+ * the number of ranges or -1 if an allocation failed.
+ */
+static int xrecord_alloc_ranges(uint16_t mask, XRecordRange **ranges) {
+    int count = 0;
+    int first = 0;
+
+    for (int type = KeyPress; type <= MotionNotify + 1; type++) {
+        bool is_selected = type <= MotionNotify && is_event_type_selected(mask, type);
+        if (is_selected && first == 0) {
+            first = type;
+        } else if (!is_selected && first != 0) {
+            ranges[count] = XRecordAllocRange();
+            if (ranges[count] == NULL) {
+                while (count > 0) {
+                    XFree(ranges[--count]);
+                }
+
+                return -1;
+            }
+
+            ranges[count]->device_events.first = first;
+            ranges[count]->device_events.last = type - 1;
+            count++;
+
+            first = 0;
+        }
+    }
+
+    return count;
+}
+
+static void xrecord_free_ranges(XRecordRange **ranges, int count) {
+    for (int i = 0; i < count; i++) {
+        XFree(ranges[i]);
+    }
+}
+
 static int xrecord_alloc() {
     int status = UIOHOOK_FAILURE;
 
@@ -893,27 +1202,20 @@ static int xrecord_alloc() {
     // Setup XRecord range.
     XRecordClientSpec clients = XRecordAllClients;
 
-    hook->data.range = XRecordAllocRange();
-    if (hook->data.range != NULL) {
-        logger(LOG_LEVEL_DEBUG, "%s [%u]: XRecordAllocRange successful.\n",
-                __FUNCTION__, __LINE__);
-
-        hook->data.range->device_events.first = KeyPress;
-        hook->data.range->device_events.last = MotionNotify;
+    hook->data.range_count = xrecord_alloc_ranges(__atomic_load_n(&event_mask, __ATOMIC_RELAXED), hook->data.ranges);
+    if (hook->data.range_count >= 0) {
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: XRecordAllocRange successful. (%i)\n",
+                __FUNCTION__, __LINE__, hook->data.range_count);
 
         // Note that the documentation for this function is incorrect,
         // hook->data.display should be used!
         // See: http://www.x.org/releases/X11R7.6/doc/libXtst/recordlib.txt
-        hook->ctrl.context = XRecordCreateContext(hook->data.display, XRecordFromServerTime, &clients, 1, &hook->data.range, 1);
+        hook->ctrl.context = XRecordCreateContext(hook->data.display, XRecordFromServerTime, &clients, 1, hook->data.ranges, hook->data.range_count);
         if (hook->ctrl.context != 0) {
             logger(LOG_LEVEL_DEBUG, "%s [%u]: XRecordCreateContext successful.\n",
                     __FUNCTION__, __LINE__);
 
-            // Block until hook_stop() is called.
-            status = xrecord_block();
-
-            // Free up the context if it was set.
-            XRecordFreeContext(hook->data.display, hook->ctrl.context);
+            status = UIOHOOK_SUCCESS;
         } else {
             logger(LOG_LEVEL_ERROR, "%s [%u]: XRecordCreateContext failure!\n",
                     __FUNCTION__, __LINE__);
@@ -921,9 +1223,6 @@ static int xrecord_alloc() {
             // Set the exit status.
             status = UIOHOOK_ERROR_X_RECORD_CREATE_CONTEXT;
         }
-
-        // Free the XRecord range.
-        XFree(hook->data.range);
     } else {
         logger(LOG_LEVEL_ERROR, "%s [%u]: XRecordAllocRange failure!\n",
                 __FUNCTION__, __LINE__);
@@ -955,6 +1254,387 @@ static int xrecord_query() {
     return status;
 }
 
+#ifdef USE_XINPUT2
+// Rebuild the core modifier state from the tracked modifiers, raw events do not carry one.
+static inline unsigned int get_core_state() {
+    uint16_t mask = get_modifiers();
+
+    unsigned int core_mask = 0x00;
+    if (mask & (MASK_SHIFT))     { core_mask |= ShiftMask;   }
+    if (mask & (MASK_CAPS_LOCK)) { core_mask |= LockMask;    }
+    if (mask & (MASK_CTRL))      { core_mask |= ControlMask; }
+    if (mask & (MASK_ALT))       { core_mask |= Mod1Mask;    }
+    if (mask & (MASK_NUM_LOCK))  { core_mask |= Mod2Mask;    }
+    if (mask & (MASK_META))      { core_mask |= Mod4Mask;    }
+
+    return core_mask;
+}
+
+// Select the raw events of the classes in the mask from all master devices.
+static void xinput_select_events(uint16_t mask) {
+    unsigned char raw_bits[XIMaskLen(XI_LASTEVENT)] = { 0 };
+    unsigned char device_bits[XIMaskLen(XI_LASTEVENT)] = { 0 };
+    if (mask & EVENT_MASK_KEYBOARD) {
+        XISetMask(raw_bits, XI_RawKeyPress);
+        XISetMask(raw_bits, XI_RawKeyRelease);
+    }
+
+    if (mask & EVENT_MASK_MOUSE_BUTTON) {
+        XISetMask(raw_bits, XI_RawButtonPress);
+        XISetMask(raw_bits, XI_RawButtonRelease);
+    }
+
+    if (mask & EVENT_MASK_MOUSE_MOTION) {
+        XISetMask(raw_bits, XI_RawMotion);
+
+        // The remembered pointer axes go stale when slave devices come, go or change.
+        XISetMask(device_bits, XI_HierarchyChanged);
+        XISetMask(device_bits, XI_DeviceChanged);
+    }
+
+    XIEventMask xi_masks[2] = {
+        {
+            .deviceid = XIAllMasterDevices,
+            .mask_len = sizeof(raw_bits),
+            .mask = raw_bits
+        },
+        {
+            .deviceid = XIAllDevices,
+            .mask_len = sizeof(device_bits),
+            .mask = device_bits
+        }
+    };
+
+    XISelectEvents(hook->data.display, DefaultRootWindow(hook->data.display), xi_masks, 2);
+    hook->xinput.mask = mask;
+}
+
+// Refresh the size of the root window the pointer is confined to.
+static void xinput_refresh_root() {
+    // Save the serial first so a change during the refresh is not missed.
+    hook->xinput.root.serial = get_settings_serial(SETTINGS_SCREEN_LAYOUT);
+
+    Window unused_win;
+    int unused_int;
+    unsigned int width, height, unused_uint;
+    if (XGetGeometry(hook->data.display, DefaultRootWindow(hook->data.display), &unused_win,
+            &unused_int, &unused_int, &width, &height, &unused_uint, &unused_uint)) {
+        hook->xinput.root.width = (int) width;
+        hook->xinput.root.height = (int) height;
+    } else {
+        logger(LOG_LEVEL_WARN, "%s [%u]: XGetGeometry failed to get the root window size!\n",
+                __FUNCTION__, __LINE__);
+
+        hook->xinput.root.width = DisplayWidth(hook->data.display, DefaultScreen(hook->data.display));
+        hook->xinput.root.height = DisplayHeight(hook->data.display, DefaultScreen(hook->data.display));
+    }
+}
+
+/* Query the pointer position from the server.  The events read while waiting
+ * for the reply were sent before it, so their motion is already included.
+ */
+static void xinput_query_pointer() {
+    Window unused_win;
+    int root_x, root_y, unused_int;
+    unsigned int unused_mask;
+    if (XQueryPointer(hook->data.display, DefaultRootWindow(hook->data.display), &unused_win, &unused_win,
+            &root_x, &root_y, &unused_int, &unused_int, &unused_mask)) {
+        hook->xinput.x = root_x;
+        hook->xinput.y = root_y;
+        hook->xinput.stale_count = XQLength(hook->data.display);
+    } else {
+        logger(LOG_LEVEL_WARN, "%s [%u]: XQueryPointer failed to get the pointer position!\n",
+                __FUNCTION__, __LINE__);
+    }
+
+    hook->xinput.is_moved = false;
+    hook->xinput.sync_time = stats_now();
+}
+
+// Get the pointer axes of a slave device, each device is only queried once.
+static struct _device * xinput_get_device(int id) {
+    for (int i = 0; i < hook->xinput.device_count; i++) {
+        if (hook->xinput.devices[i].id == id) {
+            return &hook->xinput.devices[i];
+        }
+    }
+
+    if (hook->xinput.device_count >= XINPUT_DEVICE_MAX) {
+        hook->xinput.device_count = 0;
+    }
+
+    struct _device *device = &hook->xinput.devices[hook->xinput.device_count++];
+    device->id = id;
+    device->is_tracked = false;
+
+    int count;
+    XIDeviceInfo *info = XIQueryDevice(hook->data.display, id, &count);
+    if (info != NULL) {
+        // Only relative motion can be followed, absolute devices and the
+        // XTest device, which reports screen positions, are queried instead.
+        bool is_relative[2] = { false, false };
+        for (int i = 0; i < info->num_classes && strstr(info->name, "XTEST") == NULL; i++) {
+            if (info->classes[i]->type == XIValuatorClass) {
+                XIValuatorClassInfo *valuator = (XIValuatorClassInfo *) info->classes[i];
+                if (valuator->number >= 0 && valuator->number < 2) {
+                    is_relative[valuator->number] = valuator->mode == XIModeRelative;
+                }
+            }
+        }
+
+        device->is_tracked = is_relative[0] && is_relative[1];
+
+        XIFreeDeviceInfo(info);
+    }
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Pointer motion of device %i is %s.\n",
+            __FUNCTION__, __LINE__, id, device->is_tracked ? "tracked" : "queried");
+
+    return device;
+}
+
+static void xinput_forget_device(int id) {
+    for (int i = 0; i < hook->xinput.device_count; i++) {
+        if (hook->xinput.devices[i].id == id) {
+            hook->xinput.devices[i] = hook->xinput.devices[--hook->xinput.device_count];
+            break;
+        }
+    }
+}
+
+/* Apply the raw valuators to the pointer position, returns true if the pointer
+ * moved.  Stale motion was read before the last pointer query and is already
+ * part of the position.
+ */
+static bool xinput_move_pointer(XIRawEvent *raw, bool is_stale) {
+    int16_t x = (int16_t) hook->xinput.x;
+    int16_t y = (int16_t) hook->xinput.y;
+
+    struct _device *device = xinput_get_device(raw->sourceid);
+    if (!device->is_tracked) {
+        xinput_query_pointer();
+    } else if (!is_stale) {
+        if (hook->xinput.root.serial != get_settings_serial(SETTINGS_SCREEN_LAYOUT)) {
+            xinput_refresh_root();
+        }
+
+        double position[2] = { hook->xinput.x, hook->xinput.y };
+        double size[2] = { hook->xinput.root.width, hook->xinput.root.height };
+
+        // Values are only reported for the valuators set in the mask, in order.
+        // Relative axes report the accelerated motion.
+        double *value = raw->valuators.values;
+        for (int i = 0; i < 2 && i < raw->valuators.mask_len * 8; i++) {
+            if (XIMaskIsSet(raw->valuators.mask, i)) {
+                position[i] += *value;
+                value++;
+            }
+        }
+
+        bool is_clamped = false;
+        for (int i = 0; i < 2; i++) {
+            if (position[i] < 0) {
+                position[i] = 0;
+                is_clamped = true;
+            } else if (position[i] > size[i] - 1) {
+                position[i] = size[i] - 1;
+                is_clamped = true;
+            }
+        }
+
+        hook->xinput.x = position[0];
+        hook->xinput.y = position[1];
+        hook->xinput.is_moved = true;
+
+        // The server confines the pointer to the screens rather than the root window.
+        if (is_clamped && !hook->xinput.is_clamped) {
+            xinput_query_pointer();
+        }
+        hook->xinput.is_clamped = is_clamped;
+    }
+
+    return (int16_t) hook->xinput.x != x || (int16_t) hook->xinput.y != y;
+}
+
+static void xinput_process_event(XGenericEventCookie *cookie, bool is_stale) {
+    if (cookie->evtype == XI_HierarchyChanged) {
+        // Slave devices were added or removed.
+        hook->xinput.device_count = 0;
+        return;
+    } else if (cookie->evtype == XI_DeviceChanged) {
+        // Masters switching between their slaves do not change the slave axes.
+        XIDeviceChangedEvent *change = (XIDeviceChangedEvent *) cookie->data;
+        if (change->reason == XIDeviceChange) {
+            xinput_forget_device(change->deviceid);
+        }
+        return;
+    }
+
+    XIRawEvent *raw = (XIRawEvent *) cookie->data;
+    hook->xinput.time = receive_server_time(raw->time);
+
+    stats_record_server_time((uint32_t) raw->time, hook->clock.receive_time);
+    stats_begin_translation(hook->clock.receive_time);
+
+    if (cookie->evtype == XI_RawKeyPress) {
+        process_key_pressed(hook->xinput.time, (KeyCode) raw->detail, get_core_state());
+    } else if (cookie->evtype == XI_RawKeyRelease) {
+        process_key_released(hook->xinput.time, (KeyCode) raw->detail, get_core_state());
+    } else if (cookie->evtype == XI_RawMotion) {
+        // Scroll valuators are also reported as raw motion without moving the pointer.
+        if (xinput_move_pointer(raw, is_stale)) {
+            process_mouse_moved(hook->xinput.time, (int16_t) hook->xinput.x, (int16_t) hook->xinput.y);
+        }
+    } else if (cookie->evtype == XI_RawButtonPress) {
+        // Drop any drift from pointer transformations before reporting the click.
+        xinput_query_pointer();
+
+        process_button_pressed(hook->xinput.time, raw->detail, (int16_t) hook->xinput.x, (int16_t) hook->xinput.y);
+    } else if (cookie->evtype == XI_RawButtonRelease) {
+        process_button_released(hook->xinput.time, raw->detail, (int16_t) hook->xinput.x, (int16_t) hook->xinput.y);
+    } else {
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Unhandled XInput2 event: %#X.\n",
+                __FUNCTION__, __LINE__, (unsigned int) cookie->evtype);
+    }
+
+    stats_end_translation();
+}
+
+// Deliver every XInput2 event that can be read without blocking.
+static void xinput_process_events() {
+    Display *display = hook->data.display;
+
+    // Pick up changes made by hook_set_event_mask().
+    uint16_t mask = __atomic_load_n(&event_mask, __ATOMIC_RELAXED);
+    if (mask != hook->xinput.mask) {
+        xinput_select_events(mask);
+    }
+
+    update_keyboard_layout();
+
+    do {
+        while (XPending(display) > 0) {
+            XEvent xev;
+            XNextEvent(display, &xev);
+
+            bool is_stale = hook->xinput.stale_count > 0;
+            if (is_stale) {
+                hook->xinput.stale_count--;
+            }
+
+            XGenericEventCookie *cookie = &xev.xcookie;
+            if (cookie->type == GenericEvent && cookie->extension == hook->xinput.opcode
+                    && XGetEventData(display, cookie)) {
+                xinput_process_event(cookie, is_stale);
+                XFreeEventData(display, cookie);
+            }
+        }
+
+        // Raw events do not report pointer warps, so catch up with the server
+        // now and then while the pointer moves.
+        if (hook->xinput.is_moved && stats_now() - hook->xinput.sync_time > XINPUT_SYNC_INTERVAL) {
+            int16_t x = (int16_t) hook->xinput.x;
+            int16_t y = (int16_t) hook->xinput.y;
+            xinput_query_pointer();
+
+            if ((int16_t) hook->xinput.x != x || (int16_t) hook->xinput.y != y) {
+                process_mouse_moved(hook->xinput.time, (int16_t) hook->xinput.x, (int16_t) hook->xinput.y);
+            }
+        }
+
+        // Querying the pointer may have queued more events.
+    } while (XQLength(display) > 0);
+
+    // Everything read in one pass is delivered as a single batch.
+    flush_dispatch_batch();
+}
+
+static int xinput_block() {
+    int status = UIOHOOK_SUCCESS;
+
+    if (stop_pipe_open() != 0) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: Failed to create the stop pipe! (%i)\n",
+                __FUNCTION__, __LINE__, errno);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    // XInput2 has no start of data reply to take a server time from.
+    process_hook_enabled(receive_server_time(CurrentTime));
+
+    struct pollfd fds[2] = {
+        { .fd = ConnectionNumber(hook->data.display), .events = POLLIN },
+        { .fd = stop_pipe[0], .events = POLLIN }
+    };
+
+    do {
+        xinput_process_events();
+
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            logger(LOG_LEVEL_ERROR, "%s [%u]: poll failure! (%i)\n",
+                    __FUNCTION__, __LINE__, errno);
+
+            status = UIOHOOK_FAILURE;
+            break;
+        }
+
+        if (fds[0].revents & (POLLERR | POLLHUP)) {
+            logger(LOG_LEVEL_ERROR, "%s [%u]: Lost the XInput2 connection!\n",
+                    __FUNCTION__, __LINE__);
+
+            status = UIOHOOK_FAILURE;
+            break;
+        }
+    } while (!((fds[1].revents & POLLIN) && stop_pipe_read()));
+
+    process_hook_disabled(receive_server_time(CurrentTime));
+    flush_dispatch_batch();
+
+    stop_pipe_close();
+
+    return status;
+}
+
+// Raw events are delivered to every client, regardless of grabs, since XInput 2.1.
+static bool xinput_query_version(Display *display, int *opcode) {
+    int unused_event, unused_error;
+    int major = 2, minor = 1;
+    if (XQueryExtension(display, "XInputExtension", opcode, &unused_event, &unused_error)
+            && XIQueryVersion(display, &major, &minor) == Success
+            && (major > 2 || (major == 2 && minor >= 1))) {
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: XInput version: %i.%i.\n",
+                __FUNCTION__, __LINE__, major, minor);
+
+        return true;
+    }
+
+    return false;
+}
+
+static int xinput_query() {
+    int status = UIOHOOK_ERROR_BACKEND_UNAVAILABLE;
+
+    int opcode;
+    if (xinput_query_version(hook->data.display, &opcode)) {
+        hook->xinput.opcode = opcode;
+        xinput_select_events(__atomic_load_n(&event_mask, __ATOMIC_RELAXED));
+        xinput_refresh_root();
+        xinput_query_pointer();
+
+        status = UIOHOOK_SUCCESS;
+    } else {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: XInput 2.1 is not available!\n",
+                __FUNCTION__, __LINE__);
+    }
+
+    return status;
+}
+#endif
+
 static int xrecord_start() {
     int status = UIOHOOK_FAILURE;
 
@@ -1004,17 +1684,15 @@ static int xrecord_start() {
         // Initialize starting modifiers.
         initialize_modifiers();
 
-        status = xrecord_query();
-
-        #ifdef USE_XKB_COMMON
-        if (state != NULL) {
-            destroy_xkb_state(state);
-        }
-
-        if (hook->input.context != NULL) {
-            xkb_context_unref(hook->input.context);
-            hook->input.context = NULL;
+        #ifdef USE_XINPUT2
+        // BACKEND_AUTO only picks XInput2 if the server supports it, see xinput_is_available().
+        if (is_xinput_selected) {
+            status = xinput_query();
+        } else {
+            status = xrecord_query();
         }
+        #else
+        status = xrecord_query();
         #endif
     } else {
         logger(LOG_LEVEL_ERROR, "%s [%u]: XOpenDisplay failure!\n",
@@ -1023,6 +1701,33 @@ static int xrecord_start() {
         status = UIOHOOK_ERROR_X_OPEN_DISPLAY;
     }
 
+    return status;
+}
+
+// Release everything acquired by xrecord_start(), including partial starts.
+static void xrecord_stop() {
+    // Free up the context if it was set.
+    if (hook->ctrl.context != 0) {
+        XRecordFreeContext(hook->data.display, hook->ctrl.context);
+        hook->ctrl.context = 0;
+    }
+
+    // Free the XRecord range.
+    xrecord_free_ranges(hook->data.ranges, hook->data.range_count);
+    hook->data.range_count = 0;
+
+    #ifdef USE_XKB_COMMON
+    if (state != NULL) {
+        destroy_xkb_state(state);
+        state = NULL;
+    }
+
+    if (hook->input.context != NULL) {
+        xkb_context_unref(hook->input.context);
+        hook->input.context = NULL;
+    }
+    #endif
+
     // Close down the XRecord data display.
     if (hook->data.display != NULL) {
         XCloseDisplay(hook->data.display);
@@ -1034,11 +1739,9 @@ static int xrecord_start() {
         XCloseDisplay(hook->ctrl.display);
         hook->ctrl.display = NULL;
     }
-
-    return status;
 }
 
-UIOHOOK_API int hook_run() {
+static int hook_create() {
     // Hook data for future cleanup.
     hook = malloc(sizeof(hook_info));
     if (hook == NULL) {
@@ -1048,17 +1751,125 @@ UIOHOOK_API int hook_run() {
         return UIOHOOK_ERROR_OUT_OF_MEMORY;
     }
 
+    hook->data.display = NULL;
+    hook->data.range_count = 0;
+    hook->data.is_async = false;
+    hook->ctrl.display = NULL;
+    hook->ctrl.context = 0;
+    hook->ctrl.is_polled = false;
+
+    #ifdef USE_XKB_COMMON
+    hook->input.connection = NULL;
+    hook->input.context = NULL;
+    #endif
     hook->input.mask = 0x0000;
+    hook->input.lock_serial = 0;
     hook->input.mouse.is_dragged = false;
     hook->input.mouse.click.count = 0;
     hook->input.mouse.click.time = 0;
     hook->input.mouse.click.button = MOUSE_NOBUTTON;
+    hook->input.mouse.click.interval = 200;
+    hook->input.mouse.click.serial = 0;
+    hook->screen.serial = 0;
+
+    hook->clock.server_time = 0;
+    hook->clock.receive_time = 0;
+    __atomic_store_n(&is_server_time_mapped, false, __ATOMIC_RELAXED);
+    hook->screen.x = 0;
+    hook->screen.y = 0;
+
+    #ifdef USE_XINPUT2
+    hook->xinput.opcode = 0;
+    hook->xinput.mask = 0x0000;
+    hook->xinput.time = 0;
+    hook->xinput.x = 0;
+    hook->xinput.y = 0;
+    hook->xinput.is_clamped = false;
+    hook->xinput.is_moved = false;
+    hook->xinput.sync_time = 0;
+    hook->xinput.stale_count = 0;
+    hook->xinput.root.serial = 0;
+    hook->xinput.root.width = 0;
+    hook->xinput.root.height = 0;
+    hook->xinput.device_count = 0;
+    #endif
 
-    int status = xrecord_start();
+    // Start the dispatch thread, if one was requested, before any events are produced.
+    int status = start_dispatch_queue();
+    if (status != UIOHOOK_SUCCESS) {
+        free(hook);
+        hook = NULL;
+    }
+
+    return status;
+}
+
+static void hook_destroy() {
+    xrecord_stop();
+
+    // Deliver anything still queued before returning.
+    stop_dispatch_queue();
 
     // Free data associated with this hook.
     free(hook);
     hook = NULL;
+}
+
+int x11_process_recorded_data(XRecordInterceptData *const data, size_t count) {
+    if (hook != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    int status = hook_create();
+    if (status != UIOHOOK_SUCCESS) {
+        return status;
+    }
+
+    process_hook_enabled(receive_server_time(CurrentTime));
+
+    for (size_t i = 0; i < count; i++) {
+        process_recorded_data(&data[i]);
+    }
+
+    process_hook_disabled(receive_server_time(CurrentTime));
+    flush_dispatch_batch();
+
+    hook_destroy();
+
+    return UIOHOOK_SUCCESS;
+}
+
+static int x11_hook_run() {
+    if (hook != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    int status = hook_create();
+    if (status != UIOHOOK_SUCCESS) {
+        return status;
+    }
+
+    status = xrecord_start();
+    if (status == UIOHOOK_SUCCESS) {
+        // Block until hook_stop() is called.
+        #ifdef USE_XINPUT2
+        if (hook->xinput.opcode != 0) {
+            status = xinput_block();
+        } else {
+            status = xrecord_block();
+        }
+        #else
+        status = xrecord_block();
+        #endif
+    }
+
+    hook_destroy();
 
     logger(LOG_LEVEL_DEBUG, "%s [%u]: Something, something, something, complete.\n",
             __FUNCTION__, __LINE__);
@@ -1066,27 +1877,170 @@ UIOHOOK_API int hook_run() {
     return status;
 }
 
-UIOHOOK_API int hook_stop() {
+static int x11_hook_start() {
+    if (hook != NULL) {
+        logger(LOG_LEVEL_ERROR, "%s [%u]: The hook is already running!\n",
+                __FUNCTION__, __LINE__);
+
+        return UIOHOOK_FAILURE;
+    }
+
+    int status = hook_create();
+    if (status != UIOHOOK_SUCCESS) {
+        return status;
+    }
+
+    status = xrecord_start();
+    #ifdef USE_XINPUT2
+    if (status == UIOHOOK_SUCCESS && hook->xinput.opcode != 0) {
+        // Events are read by hook_process_pending() on the caller's thread.
+        hook->ctrl.is_polled = true;
+
+        process_hook_enabled(receive_server_time(CurrentTime));
+        xinput_process_events();
+    } else
+    #endif
+    if (status == UIOHOOK_SUCCESS) {
+        // Replies are read by hook_process_pending() on the caller's thread.
+        hook->data.is_async = true;
+        if (XRecordEnableContextAsync(hook->data.display, hook->ctrl.context, hook_event_proc, NULL) != 0) {
+            hook->ctrl.is_polled = true;
+
+            // Enabling the context may have buffered replies that will not
+            // make the connection readable again.
+            xrecord_process_replies();
+        } else {
+            logger(LOG_LEVEL_ERROR, "%s [%u]: XRecordEnableContextAsync failure!\n",
+                    __FUNCTION__, __LINE__);
+
+            status = UIOHOOK_ERROR_X_RECORD_ENABLE_CONTEXT;
+        }
+    }
+
+    if (status != UIOHOOK_SUCCESS) {
+        hook_destroy();
+    }
+
+    return status;
+}
+
+static int x11_hook_get_fd() {
+    if (hook == NULL || !hook->ctrl.is_polled) {
+        return -1;
+    }
+
+    return ConnectionNumber(hook->data.display);
+}
+
+static int x11_hook_process_pending() {
+    if (hook == NULL || !hook->ctrl.is_polled) {
+        return UIOHOOK_FAILURE;
+    }
+
+    #ifdef USE_XINPUT2
+    if (hook->xinput.opcode != 0) {
+        xinput_process_events();
+
+        return UIOHOOK_SUCCESS;
+    }
+    #endif
+
+    xrecord_process_replies();
+
+    return UIOHOOK_SUCCESS;
+}
+
+static int x11_hook_set_event_mask(uint16_t mask) {
+    int status = UIOHOOK_SUCCESS;
+
+    logger(LOG_LEVEL_DEBUG, "%s [%u]: Setting event mask to %#X.\n",
+            __FUNCTION__, __LINE__, mask);
+
+    __atomic_store_n(&event_mask, mask, __ATOMIC_RELAXED);
+
+    #ifdef USE_XINPUT2
+    if (hook != NULL && hook->xinput.opcode != 0) {
+        if (hook->ctrl.is_polled) {
+            // Events are read on the caller's thread, so select them right away.
+            xinput_select_events(mask);
+            XFlush(hook->data.display);
+        } else {
+            // A hook deaf to every event would never wake to select the new mask.
+            stop_pipe_wake(WAKE_EVENT_MASK);
+        }
+    } else
+    #endif
+    if (hook != NULL && hook->ctrl.display != NULL && hook->ctrl.context != 0) {
+        // Replace the ranges of the running context rather than recreating it,
+        // so XRecordEnableContext() keeps running on the hook thread.
+        XRecordRange *ranges[3];
+        int range_count = xrecord_alloc_ranges(mask, ranges);
+        if (range_count >= 0) {
+            // Registering the clients again replaces their ranges.
+            XRecordClientSpec clients = XRecordAllClients;
+            if (XRecordRegisterClients(hook->ctrl.display, hook->ctrl.context, XRecordFromServerTime, &clients, 1, ranges, range_count) != 0) {
+                XSync(hook->ctrl.display, False);
+            } else {
+                logger(LOG_LEVEL_ERROR, "%s [%u]: XRecordRegisterClients failure!\n",
+                        __FUNCTION__, __LINE__);
+
+                status = UIOHOOK_FAILURE;
+            }
+
+            xrecord_free_ranges(ranges, range_count);
+        } else {
+            logger(LOG_LEVEL_ERROR, "%s [%u]: XRecordAllocRange failure!\n",
+                    __FUNCTION__, __LINE__);
+
+            status = UIOHOOK_ERROR_X_RECORD_ALLOC_RANGE;
+        }
+    }
+
+    return status;
+}
+
+static int x11_hook_stop() {
     int status = UIOHOOK_FAILURE;
 
+    // A threaded hook frees itself once it is woken, so read this first.
+    bool is_polled = hook != NULL && hook->ctrl.is_polled;
+
+    #ifdef USE_XINPUT2
+    if (hook != NULL && hook->xinput.opcode != 0) {
+        if (is_polled) {
+            process_hook_disabled(receive_server_time(CurrentTime));
+            flush_dispatch_batch();
+        } else {
+            stop_pipe_wake(WAKE_STOP);
+        }
+
+        status = UIOHOOK_SUCCESS;
+    } else
+    #endif
     if (hook != NULL && hook->ctrl.display != NULL && hook->ctrl.context != 0) {
+        Display *display = hook->ctrl.display;
+        XRecordContext context = hook->ctrl.context;
+
         // We need to make sure the context is still valid.
         XRecordState *state = malloc(sizeof(XRecordState));
         if (state != NULL) {
-            if (XRecordGetContext(hook->ctrl.display, hook->ctrl.context, &state) != 0) {
+            if (XRecordGetContext(display, context, &state) != 0) {
                 // Try to exit the thread naturally.
-                if (state->enabled && XRecordDisableContext(hook->ctrl.display, hook->ctrl.context) != 0) {
-                    #ifdef USE_XRECORD_ASYNC
-                    pthread_mutex_lock(&hook_xrecord_mutex);
-                    running = false;
-                    pthread_cond_signal(&hook_xrecord_cond);
-                    pthread_mutex_unlock(&hook_xrecord_mutex);
-                    #endif
-
+                if (state->enabled && XRecordDisableContext(display, context) != 0) {
                     // See Bug 42356 for more information.
                     // https://bugs.freedesktop.org/show_bug.cgi?id=42356#c4
-                    //XFlush(hook->ctrl.display);
-                    XSync(hook->ctrl.display, False);
+                    //XFlush(display);
+                    XSync(display, False);
+
+                    if (is_polled) {
+                        // Deliver the end of data before tearing the hook down.
+                        xrecord_process_replies();
+                    }
+
+                    #ifdef USE_XRECORD_ASYNC
+                    // Wake the asynchronous loop.
+                    stop_pipe_wake(WAKE_STOP);
+                    #endif
 
                     status = UIOHOOK_SUCCESS;
                 }
@@ -1106,8 +2060,111 @@ UIOHOOK_API int hook_stop() {
         }
     }
 
+    // There is no hook thread to clean up after an event loop driven hook.
+    if (is_polled) {
+        hook_destroy();
+    }
+
     logger(LOG_LEVEL_DEBUG, "%s [%u]: Status: %#X.\n",
             __FUNCTION__, __LINE__, status);
 
     return status;
 }
+
+static uint64_t x11_time_to_monotonic(uint64_t time) {
+    if (!__atomic_load_n(&is_server_time_mapped, __ATOMIC_ACQUIRE)) {
+        return 0;
+    }
+
+    return (uint64_t) ((int64_t) (time * 1000000) + __atomic_load_n(&server_time_offset, __ATOMIC_RELAXED));
+}
+
+static bool x11_is_available() {
+    return helper_disp != NULL;
+}
+
+#ifdef USE_XINPUT2
+static int xrecord_hook_run() {
+    is_xinput_selected = false;
+
+    return x11_hook_run();
+}
+
+static int xrecord_hook_start() {
+    is_xinput_selected = false;
+
+    return x11_hook_start();
+}
+
+static bool xinput_is_available() {
+    // The server does not change while the helper display is open.
+    static int is_supported = -1;
+    if (is_supported < 0 && helper_disp != NULL) {
+        int unused_opcode;
+        is_supported = xinput_query_version(helper_disp, &unused_opcode);
+    }
+
+    return is_supported > 0;
+}
+
+static int xinput_hook_run() {
+    is_xinput_selected = true;
+
+    return x11_hook_run();
+}
+
+static int xinput_hook_start() {
+    is_xinput_selected = true;
+
+    return x11_hook_start();
+}
+
+const hook_backend xinput_backend = {
+    .type = BACKEND_XINPUT2,
+    .is_available = xinput_is_available,
+
+    .run = xinput_hook_run,
+    .stop = x11_hook_stop,
+    .start = xinput_hook_start,
+    .get_fd = x11_hook_get_fd,
+    .process_pending = x11_hook_process_pending,
+    .set_event_mask = x11_hook_set_event_mask,
+    .time_to_monotonic = x11_time_to_monotonic,
+
+    .post_event = x11_post_event,
+
+    .create_screen_info = x11_create_screen_info,
+    .get_auto_repeat_rate = x11_get_auto_repeat_rate,
+    .get_auto_repeat_delay = x11_get_auto_repeat_delay,
+    .get_pointer_acceleration_multiplier = x11_get_pointer_acceleration_multiplier,
+    .get_pointer_acceleration_threshold = x11_get_pointer_acceleration_threshold,
+    .get_pointer_sensitivity = x11_get_pointer_sensitivity,
+    .get_multi_click_time = x11_get_multi_click_time
+};
+#else
+#define xrecord_hook_run x11_hook_run
+#define xrecord_hook_start x11_hook_start
+#endif
+
+const hook_backend xrecord_backend = {
+    .type = BACKEND_XRECORD,
+    .is_available = x11_is_available,
+
+    .run = xrecord_hook_run,
+    .stop = x11_hook_stop,
+    .start = xrecord_hook_start,
+    .get_fd = x11_hook_get_fd,
+    .process_pending = x11_hook_process_pending,
+    .set_event_mask = x11_hook_set_event_mask,
+    .time_to_monotonic = x11_time_to_monotonic,
+
+    .post_event = x11_post_event,
+
+    .create_screen_info = x11_create_screen_info,
+    .get_auto_repeat_rate = x11_get_auto_repeat_rate,
+    .get_auto_repeat_delay = x11_get_auto_repeat_delay,
+    .get_pointer_acceleration_multiplier = x11_get_pointer_acceleration_multiplier,
+    .get_pointer_acceleration_threshold = x11_get_pointer_acceleration_threshold,
+    .get_pointer_sensitivity = x11_get_pointer_sensitivity,
+    .get_multi_click_time = x11_get_multi_click_time
+};
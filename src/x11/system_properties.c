@@ -16,12 +16,16 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <limits.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <uiohook.h>
+#include <X11/Xatom.h>
 #include <X11/Xlib.h>
 #include <X11/XKBlib.h>
+#include <X11/Xresource.h>
 
 #ifdef USE_XF86MISC
 #include <X11/extensions/xf86misc.h>
@@ -31,7 +35,6 @@
 #if defined(USE_XINERAMA) && !defined(USE_XRANDR)
 #include <X11/extensions/Xinerama.h>
 #elif defined(USE_XRANDR)
-#include <pthread.h>
 #include <X11/extensions/Xrandr.h>
 #endif
 
@@ -45,71 +48,201 @@ static Display *xt_disp;
 #include "input_helper.h"
 #include "logger.h"
 
+// Change serials for each settings_type, only written by the settings thread.
+static unsigned int settings_serial[SETTINGS_TYPE_COUNT];
+
+// Resource database loaded from the current RESOURCE_MANAGER root property.
+static pthread_mutex_t resource_mutex = PTHREAD_MUTEX_INITIALIZER;
+static XrmDatabase resource_db = NULL;
+static unsigned int resource_serial;
+static bool is_resource_loaded = false;
+
 #ifdef USE_XRANDR
 static pthread_mutex_t xrandr_mutex = PTHREAD_MUTEX_INITIALIZER;
 static XRRScreenResources *xrandr_resources = NULL;
 
+static void update_xrandr_resources(Display *settings_disp, Window root) {
+    pthread_mutex_lock(&xrandr_mutex);
+    if (xrandr_resources != NULL) {
+        XRRFreeScreenResources(xrandr_resources);
+    }
+
+    xrandr_resources = XRRGetScreenResources(settings_disp, root);
+    if (xrandr_resources == NULL) {
+        logger(LOG_LEVEL_WARN, "%s [%u]: XRandR could not get screen resources!\n",
+                __FUNCTION__, __LINE__);
+    }
+    pthread_mutex_unlock(&xrandr_mutex);
+}
+#endif
+
+unsigned int get_settings_serial(settings_type type) {
+    return __atomic_load_n(&settings_serial[type], __ATOMIC_ACQUIRE);
+}
+
+// Notify cached copies of the given settings that they are out of date.
+static void invalidate_settings(settings_type type) {
+    __atomic_add_fetch(&settings_serial[type], 1, __ATOMIC_RELEASE);
+}
+
+/* Reload resource_db if the RESOURCE_MANAGER property changed since it was last
+ * read.  XGetDefault() only ever sees the resources present when the display
+ * was opened, so the property is read directly.  Must hold resource_mutex.
+ */
+static void update_resource_database() {
+    unsigned int serial = get_settings_serial(SETTINGS_RESOURCE_MANAGER);
+    if (!is_resource_loaded || serial != resource_serial) {
+        resource_serial = serial;
+        is_resource_loaded = true;
+
+        if (resource_db != NULL) {
+            XrmDestroyDatabase(resource_db);
+            resource_db = NULL;
+        }
+
+        Atom actual_type;
+        int actual_format;
+        unsigned long nitems, bytes_after;
+        unsigned char *xprop = NULL;
+        if (XGetWindowProperty(helper_disp, XDefaultRootWindow(helper_disp), XA_RESOURCE_MANAGER, 0, LONG_MAX, False, XA_STRING,
+                &actual_type, &actual_format, &nitems, &bytes_after, &xprop) == Success && xprop != NULL) {
+            if (actual_type == XA_STRING && actual_format == 8) {
+                resource_db = XrmGetStringDatabase((char *) xprop);
+            }
+
+            XFree(xprop);
+        }
+
+        logger(LOG_LEVEL_DEBUG, "%s [%u]: Loaded RESOURCE_MANAGER database. (%#p)\n",
+                __FUNCTION__, __LINE__, resource_db);
+    }
+}
+
 static void settings_cleanup_proc(void *arg) {
+    #ifdef USE_XRANDR
     if (pthread_mutex_trylock(&xrandr_mutex) == 0) {
         if (xrandr_resources != NULL) {
             XRRFreeScreenResources(xrandr_resources);
             xrandr_resources = NULL;
         }
 
-        if (arg != NULL) {
-            XCloseDisplay((Display *) arg);
-            arg = NULL;
-        }
-
         pthread_mutex_unlock(&xrandr_mutex);
     }
+    #endif
+
+    if (arg != NULL) {
+        XCloseDisplay((Display *) arg);
+        arg = NULL;
+    }
 }
 
+/* The settings thread listens for configuration changes on its own display
+ * connection so that the hook never has to poll the X server for values that
+ * rarely change.
+ */
 static void *settings_thread_proc(void *arg) {
-    Display *settings_disp = XOpenDisplay(XDisplayName(NULL));;
+    Display *settings_disp = XOpenDisplay(XDisplayName(NULL));
     if (settings_disp != NULL) {
         logger(LOG_LEVEL_DEBUG, "%s [%u]: %s\n",
                 __FUNCTION__, __LINE__, "XOpenDisplay success.");
 
         pthread_cleanup_push(settings_cleanup_proc, settings_disp);
 
+        Window root = XDefaultRootWindow(settings_disp);
+
+        #ifdef USE_XRANDR
         int event_base = 0;
         int error_base = 0;
-        if (XRRQueryExtension(settings_disp, &event_base, &error_base)) {
-            Window root = XDefaultRootWindow(settings_disp);
-            unsigned long event_mask = RRScreenChangeNotifyMask;
-            XRRSelectInput(settings_disp, root, event_mask);
+        bool is_xrandr = XRRQueryExtension(settings_disp, &event_base, &error_base);
+        if (is_xrandr) {
+            XRRSelectInput(settings_disp, root, RRScreenChangeNotifyMask);
+
+            // Populate the initial resources, change events will keep them current.
+            update_xrandr_resources(settings_disp, root);
+            invalidate_settings(SETTINGS_SCREEN_LAYOUT);
+        } else {
+            logger(LOG_LEVEL_WARN, "%s [%u]: XRandR is not currently available!\n",
+                    __FUNCTION__, __LINE__);
+        }
+        #endif
 
-            XEvent ev;
+        // The root window is resized whenever the monitor layout is reconfigured
+        // and its RESOURCE_MANAGER property is replaced when X resources change.
+        XSelectInput(settings_disp, root, StructureNotifyMask | PropertyChangeMask);
+
+        int xkb_event_base = 0;
+        int xkb_major = XkbMajorVersion, xkb_minor = XkbMinorVersion, unused_int;
+        bool is_xkb = XkbQueryExtension(settings_disp, &unused_int, &xkb_event_base, &unused_int, &xkb_major, &xkb_minor);
+        if (is_xkb) {
+            // Layout changes replace the keyboard or its keymap.
+            unsigned int xkb_mask = XkbIndicatorStateNotifyMask | XkbNewKeyboardNotifyMask | XkbMapNotifyMask;
+            XkbSelectEvents(settings_disp, XkbUseCoreKbd, xkb_mask, xkb_mask);
+        } else {
+            logger(LOG_LEVEL_WARN, "%s [%u]: XKB is not currently available!\n",
+                    __FUNCTION__, __LINE__);
+        }
 
-            while(settings_disp != NULL) {
-                XNextEvent(settings_disp, &ev);
+        bool is_layout_changed = false;
 
-                if (ev.type == event_base + RRScreenChangeNotifyMask) {
-                    logger(LOG_LEVEL_DEBUG, "%s [%u]: Received XRRScreenChangeNotifyEvent.\n",
-                            __FUNCTION__, __LINE__);
+        XEvent ev;
+        while (settings_disp != NULL) {
+            // A layout switch sends a burst of notifications, rebuild once it has been read.
+            if (is_layout_changed && XPending(settings_disp) == 0) {
+                is_layout_changed = false;
+                publish_keyboard_layout(create_keyboard_layout(settings_disp));
+            }
 
-                    pthread_mutex_lock(&xrandr_mutex);
-                    if (xrandr_resources != NULL) {
-                        XRRFreeScreenResources(xrandr_resources);
-                    }
+            XNextEvent(settings_disp, &ev);
 
-                    xrandr_resources = XRRGetScreenResources(settings_disp, root);
-                    if (xrandr_resources == NULL) {
-                        logger(LOG_LEVEL_WARN, "%s [%u]: XRandR could not get screen resources!\n",
-                                __FUNCTION__, __LINE__);
-                    }
-                    pthread_mutex_unlock(&xrandr_mutex);
-                } else {
-                    logger(LOG_LEVEL_WARN, "%s [%u]: XRandR is not currently available!\n",
+            #ifdef USE_XRANDR
+            if (is_xrandr && ev.type == event_base + RRScreenChangeNotify) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: Received XRRScreenChangeNotifyEvent.\n",
+                        __FUNCTION__, __LINE__);
+
+                XRRUpdateConfiguration(&ev);
+                update_xrandr_resources(settings_disp, root);
+                invalidate_settings(SETTINGS_SCREEN_LAYOUT);
+            } else
+            #endif
+            if (ev.type == ConfigureNotify && ev.xconfigure.window == root) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: Received root window ConfigureNotify.\n",
+                        __FUNCTION__, __LINE__);
+
+                invalidate_settings(SETTINGS_SCREEN_LAYOUT);
+            } else if (ev.type == PropertyNotify && ev.xproperty.atom == XA_RESOURCE_MANAGER) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: Received RESOURCE_MANAGER PropertyNotify.\n",
+                        __FUNCTION__, __LINE__);
+
+                invalidate_settings(SETTINGS_RESOURCE_MANAGER);
+            } else if (ev.type == MappingNotify) {
+                // Mapping notifications are sent to every client without selection.
+                if (ev.xmapping.request == MappingPointer) {
+                    logger(LOG_LEVEL_DEBUG, "%s [%u]: Received pointer MappingNotify.\n",
                             __FUNCTION__, __LINE__);
+
+                    invalidate_settings(SETTINGS_POINTER_MAPPING);
+                } else {
+                    XRefreshKeyboardMapping(&ev.xmapping);
+                }
+            } else if (is_xkb && ev.type == xkb_event_base) {
+                XkbEvent *xkb_event = (XkbEvent *) &ev;
+                if (xkb_event->any.xkb_type == XkbIndicatorStateNotify) {
+                    logger(LOG_LEVEL_DEBUG, "%s [%u]: Received XkbIndicatorStateNotify. (%#X)\n",
+                            __FUNCTION__, __LINE__, xkb_event->indicators.state);
+
+                    invalidate_settings(SETTINGS_INDICATOR_STATE);
+                } else if (xkb_event->any.xkb_type == XkbNewKeyboardNotify || xkb_event->any.xkb_type == XkbMapNotify) {
+                    logger(LOG_LEVEL_DEBUG, "%s [%u]: Received %s.\n",
+                            __FUNCTION__, __LINE__,
+                            xkb_event->any.xkb_type == XkbMapNotify ? "XkbMapNotify" : "XkbNewKeyboardNotify");
+
+                    is_layout_changed = true;
                 }
             }
         }
 
         // Execute the thread cleanup handler.
         pthread_cleanup_pop(1);
-
     } else {
         logger(LOG_LEVEL_ERROR, "%s [%u]: XOpenDisplay failure!\n",
                 __FUNCTION__, __LINE__);
@@ -117,9 +250,8 @@ static void *settings_thread_proc(void *arg) {
 
     return NULL;
 }
-#endif
 
-UIOHOOK_API screen_data* hook_create_screen_info(unsigned char *count) {
+screen_data* x11_create_screen_info(unsigned char *count) {
     *count = 0;
     screen_data *screens = NULL;
 
@@ -220,7 +352,7 @@ UIOHOOK_API screen_data* hook_create_screen_info(unsigned char *count) {
     return screens;
 }
 
-UIOHOOK_API long int hook_get_auto_repeat_rate() {
+long int x11_get_auto_repeat_rate() {
     bool successful = false;
     long int value = -1;
     unsigned int delay = 0, rate = 0;
@@ -263,7 +395,7 @@ UIOHOOK_API long int hook_get_auto_repeat_rate() {
     return value;
 }
 
-UIOHOOK_API long int hook_get_auto_repeat_delay() {
+long int x11_get_auto_repeat_delay() {
     bool successful = false;
     long int value = -1;
     unsigned int delay = 0, rate = 0;
@@ -306,7 +438,7 @@ UIOHOOK_API long int hook_get_auto_repeat_delay() {
     return value;
 }
 
-UIOHOOK_API long int hook_get_pointer_acceleration_multiplier() {
+long int x11_get_pointer_acceleration_multiplier() {
     long int value = -1;
     int accel_numerator, accel_denominator, threshold;
 
@@ -327,7 +459,7 @@ UIOHOOK_API long int hook_get_pointer_acceleration_multiplier() {
     return value;
 }
 
-UIOHOOK_API long int hook_get_pointer_acceleration_threshold() {
+long int x11_get_pointer_acceleration_threshold() {
     long int value = -1;
     int accel_numerator, accel_denominator, threshold;
 
@@ -348,7 +480,7 @@ UIOHOOK_API long int hook_get_pointer_acceleration_threshold() {
     return value;
 }
 
-UIOHOOK_API long int hook_get_pointer_sensitivity() {
+long int x11_get_pointer_sensitivity() {
     long int value = -1;
     int accel_numerator, accel_denominator, threshold;
 
@@ -369,11 +501,42 @@ UIOHOOK_API long int hook_get_pointer_sensitivity() {
     return value;
 }
 
-UIOHOOK_API long int hook_get_multi_click_time() {
+long int x11_get_multi_click_time() {
     long int value = 200;
     int click_time;
     bool successful = false;
 
+    // Check and make sure we could connect to the x server.
+    if (helper_disp != NULL) {
+        // Try and acquire the multi-click time from the current X resources.
+        pthread_mutex_lock(&resource_mutex);
+        update_resource_database();
+        if (resource_db != NULL) {
+            char *type;
+            XrmValue xrm_value;
+
+            if (!successful && XrmGetResource(resource_db, "multiClickTime", "MultiClickTime", &type, &xrm_value)
+                    && sscanf(xrm_value.addr, "%4i", &click_time) == 1) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: X resource 'multiClickTime' property: %i.\n",
+                        __FUNCTION__, __LINE__, click_time);
+
+                successful = true;
+            }
+
+            if (!successful && XrmGetResource(resource_db, "OpenWindows.MultiClickTimeout", "OpenWindows.MultiClickTimeout", &type, &xrm_value)
+                    && sscanf(xrm_value.addr, "%4i", &click_time) == 1) {
+                logger(LOG_LEVEL_DEBUG, "%s [%u]: X resource 'MultiClickTimeout' property: %i.\n",
+                        __FUNCTION__, __LINE__, click_time);
+
+                successful = true;
+            }
+        }
+        pthread_mutex_unlock(&resource_mutex);
+    } else {
+        logger(LOG_LEVEL_WARN, "%s [%u]: XDisplay helper_disp is unavailable!\n",
+            __FUNCTION__, __LINE__);
+    }
+
     #ifdef USE_XT
     // Check and make sure we could connect to the x server.
     if (xt_disp != NULL) {
@@ -416,9 +579,6 @@ UIOHOOK_API long int hook_get_multi_click_time() {
                 successful = true;
             }
         }
-    } else {
-        logger(LOG_LEVEL_WARN, "%s [%u]: XDisplay helper_disp is unavailable!\n",
-            __FUNCTION__, __LINE__);
     }
 
     if (successful) {
@@ -444,7 +604,6 @@ void on_library_load() {
                 __FUNCTION__, __LINE__, "XOpenDisplay success.");
     }
 
-    #ifdef USE_XRANDR
     // Create the thread attribute.
     pthread_attr_t settings_thread_attr;
     pthread_attr_init(&settings_thread_attr);
@@ -460,7 +619,6 @@ void on_library_load() {
 
     // Make sure the thread attribute is removed.
     pthread_attr_destroy(&settings_thread_attr);
-    #endif
 
     #ifdef USE_XT
     XtToolkitInitialize();
@@ -481,6 +639,14 @@ void on_library_unload() {
     // Cleanup.
     unload_input_helper();
 
+    pthread_mutex_lock(&resource_mutex);
+    if (resource_db != NULL) {
+        XrmDestroyDatabase(resource_db);
+        resource_db = NULL;
+    }
+    is_resource_loaded = false;
+    pthread_mutex_unlock(&resource_mutex);
+
     #ifdef USE_XT
     XtCloseDisplay(xt_disp);
     XtDestroyApplicationContext(xt_context);
@@ -0,0 +1,114 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _included_benchmark
+#define _included_benchmark
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Number of times each benchmark is repeated, the fastest run is reported.
+#define BENCH_REPEAT 5
+
+static inline uint64_t bench_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+// Print one result line, count operations took elapsed nanoseconds.
+static inline void bench_report(const char *name, uint64_t count, uint64_t elapsed) {
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+
+    printf("%-32s %10llu %12.1f %14.0f\n", name, (unsigned long long) count,
+            (double) elapsed / (double) count, (double) count * 1e9 / (double) elapsed);
+}
+
+static inline void bench_header(const char *title) {
+    printf("\n%-32s %10s %12s %14s\n", title, "count", "ns/op", "ops/sec");
+}
+
+/* Latency distributions are sampled in batches of calls, a single call is too
+ * short to time against the clock overhead.  Each sample is the mean of one
+ * batch.
+ */
+#define BENCH_BATCH 64
+#define BENCH_SAMPLES 16384
+
+// Size of the input mixes, a power of two so the index can be masked.
+#define BENCH_MIX 1024
+
+// Results are folded into the sink so the calls cannot be optimized out.
+extern volatile uint64_t bench_sink;
+
+/* Time BENCH_SAMPLES batches of BENCH_BATCH evaluations of expr, with i set to
+ * the index of the input to use, and report the distribution.
+ */
+#define BENCH_DISTRIBUTION(name, expr) \
+    do { \
+        static uint64_t samples[BENCH_SAMPLES]; \
+        uint64_t sink = 0; \
+        for (size_t sample = 0; sample < BENCH_SAMPLES; sample++) { \
+            uint64_t start = bench_now(); \
+            for (size_t call = 0; call < BENCH_BATCH; call++) { \
+                size_t i = (sample * BENCH_BATCH + call) & (BENCH_MIX - 1); \
+                sink += (uint64_t) (expr); \
+            } \
+            samples[sample] = bench_now() - start; \
+        } \
+        bench_sink += sink; \
+        bench_report_distribution(name, samples); \
+    } while (0)
+
+static inline int bench_compare(const void *a, const void *b) {
+    uint64_t left = *(const uint64_t *) a;
+    uint64_t right = *(const uint64_t *) b;
+
+    return (left > right) - (left < right);
+}
+
+static inline void bench_distribution_header(const char *title) {
+    printf("\n%-32s %10s %12s %14s %8s %8s %8s\n", title, "count", "ns/op", "ops/sec", "p50", "p99", "max");
+}
+
+static inline void bench_report_distribution(const char *name, uint64_t *samples) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+        total += samples[i];
+    }
+    if (total == 0) {
+        total = 1;
+    }
+
+    qsort(samples, BENCH_SAMPLES, sizeof(uint64_t), bench_compare);
+
+    uint64_t count = (uint64_t) BENCH_SAMPLES * BENCH_BATCH;
+    printf("%-32s %10llu %12.2f %14.0f %8.2f %8.2f %8.2f\n", name, (unsigned long long) count,
+            (double) total / (double) count, (double) count * 1e9 / (double) total,
+            (double) samples[BENCH_SAMPLES / 2] / BENCH_BATCH,
+            (double) samples[BENCH_SAMPLES - BENCH_SAMPLES / 100] / BENCH_BATCH,
+            (double) samples[BENCH_SAMPLES - 1] / BENCH_BATCH);
+}
+
+#endif
@@ -0,0 +1,214 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <uiohook.h>
+
+#ifdef USE_X11
+#include <X11/Xlib.h>
+#include <X11/Xproto.h>
+#include <X11/extensions/record.h>
+#else
+#include <linux/input.h>
+#endif
+
+#include "benchmark.h"
+#include "input_helper.h"
+
+/* Measures the cost of turning native input into dispatched events.  Prebuilt
+ * native streams are handed to the backend's synthetic entry point, so the
+ * numbers cover translation and dispatch but no reads from the system.  The
+ * cost is reported per native event, for evdev that includes the EV_SYN
+ * reports.
+ */
+#define BENCH_EVENTS 200000
+
+static uint64_t dispatched = 0;
+
+static void count_event(uiohook_event *const event) {
+    dispatched++;
+}
+
+#ifdef USE_X11
+static xEvent datums[BENCH_EVENTS];
+static XRecordInterceptData records[BENCH_EVENTS];
+
+static void set_native(size_t i, unsigned char type, unsigned char detail, int16_t x, int16_t y) {
+    memset(&datums[i], 0, sizeof(xEvent));
+    datums[i].u.u.type = type;
+    datums[i].u.u.detail = detail;
+    datums[i].u.keyButtonPointer.rootX = x;
+    datums[i].u.keyButtonPointer.rootY = y;
+
+    memset(&records[i], 0, sizeof(XRecordInterceptData));
+    records[i].server_time = (Time) i;
+    records[i].category = XRecordFromServer;
+    records[i].data = (unsigned char *) &datums[i];
+    records[i].data_len = sizeof(xEvent) / 4;
+}
+
+static void add_key(size_t *count, unsigned int key) {
+    // Cycle through the keycodes of the main alphanumeric block.
+    unsigned char keycode = 24 + key % 30;
+    set_native((*count)++, KeyPress, keycode, 0, 0);
+    set_native((*count)++, KeyRelease, keycode, 0, 0);
+}
+
+static void add_button(size_t *count, unsigned char button, int16_t x, int16_t y) {
+    set_native((*count)++, ButtonPress, button, x, y);
+    set_native((*count)++, ButtonRelease, button, x, y);
+}
+
+static void add_motion(size_t *count, int16_t x, int16_t y) {
+    set_native((*count)++, MotionNotify, 0, x, y);
+}
+
+static int process_native(size_t count) {
+    return x11_process_recorded_data(records, count);
+}
+#else
+static struct input_event datums[BENCH_EVENTS];
+
+static void set_native(size_t i, uint16_t type, uint16_t code, int32_t value) {
+    memset(&datums[i], 0, sizeof(struct input_event));
+    datums[i].type = type;
+    datums[i].code = code;
+    datums[i].value = value;
+}
+
+static void add_key(size_t *count, unsigned int key) {
+    // Cycle through the key codes of the main alphanumeric block.
+    uint16_t code = KEY_Q + key % 30;
+    set_native((*count)++, EV_KEY, code, 1);
+    set_native((*count)++, EV_SYN, SYN_REPORT, 0);
+    set_native((*count)++, EV_KEY, code, 0);
+    set_native((*count)++, EV_SYN, SYN_REPORT, 0);
+}
+
+static void add_button(size_t *count, unsigned char button, int16_t x, int16_t y) {
+    if (button == 4 || button == 5) {
+        set_native((*count)++, EV_REL, REL_WHEEL, button == 4 ? 1 : -1);
+        set_native((*count)++, EV_SYN, SYN_REPORT, 0);
+    } else {
+        set_native((*count)++, EV_KEY, BTN_LEFT, 1);
+        set_native((*count)++, EV_SYN, SYN_REPORT, 0);
+        set_native((*count)++, EV_KEY, BTN_LEFT, 0);
+        set_native((*count)++, EV_SYN, SYN_REPORT, 0);
+    }
+}
+
+static void add_motion(size_t *count, int16_t x, int16_t y) {
+    // Relative devices report the movement, alternate directions to stay in place.
+    set_native((*count)++, EV_REL, REL_X, x % 2 ? 1 : -1);
+    set_native((*count)++, EV_REL, REL_Y, y % 2 ? 1 : -1);
+    set_native((*count)++, EV_SYN, SYN_REPORT, 0);
+}
+
+static int process_native(size_t count) {
+    return evdev_process_input_events(datums, count);
+}
+#endif
+
+// Each builder fills the native stream and returns the number of native events.
+static size_t build_keyboard() {
+    size_t count = 0;
+    for (unsigned int i = 0; count + 4 <= BENCH_EVENTS; i++) {
+        add_key(&count, i);
+    }
+
+    return count;
+}
+
+static size_t build_buttons() {
+    size_t count = 0;
+    while (count + 4 <= BENCH_EVENTS) {
+        add_button(&count, 1, 100, 100);
+    }
+
+    return count;
+}
+
+static size_t build_wheel() {
+    size_t count = 0;
+    for (unsigned int i = 0; count + 4 <= BENCH_EVENTS; i++) {
+        add_button(&count, i % 2 ? 4 : 5, 100, 100);
+    }
+
+    return count;
+}
+
+static size_t build_motion() {
+    size_t count = 0;
+    for (int16_t i = 0; count + 3 <= BENCH_EVENTS; i++) {
+        add_motion(&count, i % 1024, i % 768);
+    }
+
+    return count;
+}
+
+// Mostly motion with the occasional key, click and wheel step.
+static size_t build_mixed() {
+    size_t count = 0;
+    for (unsigned int i = 0; count + 64 <= BENCH_EVENTS; i++) {
+        for (int16_t j = 0; j < 10; j++) {
+            add_motion(&count, (int16_t) (i % 1024), j);
+        }
+
+        add_key(&count, i);
+        add_button(&count, 1, (int16_t) (i % 1024), 10);
+        add_button(&count, i % 2 ? 4 : 5, (int16_t) (i % 1024), 10);
+    }
+
+    return count;
+}
+
+static void run_stream(const char *name, size_t (*build)()) {
+    size_t count = build();
+
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < BENCH_REPEAT; i++) {
+        dispatched = 0;
+
+        uint64_t start = bench_now();
+        if (process_native(count) != UIOHOOK_SUCCESS) {
+            printf("%-32s failed\n", name);
+            return;
+        }
+        uint64_t elapsed = bench_now() - start;
+
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    bench_report(name, count, best);
+    printf("%-32s %10llu dispatched\n", "", (unsigned long long) dispatched);
+}
+
+void hook_benchmarks() {
+    hook_set_dispatch_proc(&count_event);
+
+    bench_header("hook translation");
+    run_stream("keyboard", build_keyboard);
+    run_stream("buttons", build_buttons);
+    run_stream("wheel", build_wheel);
+    run_stream("motion", build_motion);
+    run_stream("mixed", build_mixed);
+}
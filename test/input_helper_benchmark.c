@@ -0,0 +1,176 @@
+/* libUIOHook: Cross-platform keyboard and mouse hooking from userland.
+ * Copyright (C) 2006-2023 Alexander Barker.  All Rights Reserved.
+ * https://github.com/kwhat/libuiohook/
+ *
+ * libUIOHook is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libUIOHook is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <uiohook.h>
+
+#ifdef USE_X11
+#include <X11/Xlib.h>
+#include <X11/keysym.h>
+#endif
+
+#include "benchmark.h"
+#include "input_helper.h"
+
+volatile uint64_t bench_sink = 0;
+
+// Typed text the key mixes are built from, capitals are typed with shift.
+static const char *sample_text =
+    "The quick brown fox jumps over the lazy dog, then naps for 15 minutes.\n"
+    "Please send the Q3 report to accounting before Friday; they need it by 9.\n"
+    "it's a small change - rename the helper, update 2 callers and re-run the tests.\n";
+
+static const uint16_t letter_scancodes[26] = {
+    VC_A, VC_B, VC_C, VC_D, VC_E, VC_F, VC_G, VC_H, VC_I, VC_J, VC_K, VC_L, VC_M,
+    VC_N, VC_O, VC_P, VC_Q, VC_R, VC_S, VC_T, VC_U, VC_V, VC_W, VC_X, VC_Y, VC_Z
+};
+
+static const uint16_t digit_scancodes[10] = {
+    VC_0, VC_1, VC_2, VC_3, VC_4, VC_5, VC_6, VC_7, VC_8, VC_9
+};
+
+// Input mixes, filled by build_mixes().
+static uint16_t scancodes[BENCH_MIX];
+static uint16_t keycodes[BENCH_MIX];
+static unsigned int modifiers[BENCH_MIX];
+#ifdef USE_X11
+static KeySym keysyms[BENCH_MIX];
+static KeySym keysyms_intl[BENCH_MIX];
+static uint16_t characters[BENCH_MIX];
+static uint16_t characters_intl[BENCH_MIX];
+#endif
+
+static uint16_t char_to_scancode(char c) {
+    if (isalpha((unsigned char) c)) {
+        return letter_scancodes[tolower((unsigned char) c) - 'a'];
+    } else if (isdigit((unsigned char) c)) {
+        return digit_scancodes[c - '0'];
+    }
+
+    switch (c) {
+        case ' ':  return VC_SPACE;
+        case '.':  return VC_PERIOD;
+        case ',':  return VC_COMMA;
+        case ';':  return VC_SEMICOLON;
+        case '\'': return VC_QUOTE;
+        case '-':  return VC_MINUS;
+        case '\n': return VC_ENTER;
+        default:   return VC_SLASH;
+    }
+}
+
+static void build_mixes() {
+    size_t length = 0;
+    while (sample_text[length] != '\0') {
+        length++;
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < BENCH_MIX; i++) {
+        char c = sample_text[offset++ % length];
+
+        // Capitals add a shift press before the letter.
+        unsigned int mask = 0;
+        if (isupper((unsigned char) c) && i + 1 < BENCH_MIX) {
+            scancodes[i] = VC_SHIFT_L;
+            #ifdef USE_X11
+            keysyms[i] = XK_Shift_L;
+            characters[i] = ' ';
+            #endif
+            modifiers[i] = 0;
+            i++;
+
+            #ifdef USE_X11
+            mask = ShiftMask;
+            #else
+            mask = 1;
+            #endif
+        }
+
+        scancodes[i] = char_to_scancode(c);
+        modifiers[i] = mask;
+
+        #ifdef USE_X11
+        // Latin-1 keysyms match their characters.
+        keysyms[i] = c == '\n' ? XK_Return : (KeySym) c;
+        characters[i] = c == '\n' ? ' ' : (uint16_t) c;
+        #endif
+    }
+
+    for (size_t i = 0; i < BENCH_MIX; i++) {
+        keycodes[i] = (uint16_t) scancode_to_keycode(scancodes[i]);
+    }
+
+    #ifdef USE_X11
+    // Cyrillic and Greek letters, plus keypad and function keys that have no character.
+    for (size_t i = 0; i < BENCH_MIX; i++) {
+        switch (i % 4) {
+            case 0:  keysyms_intl[i] = XK_Cyrillic_a + (i / 4) % 32; break;
+            case 1:  keysyms_intl[i] = XK_Greek_alpha + (i / 4) % 24; break;
+            case 2:  keysyms_intl[i] = XK_Cyrillic_A + (i / 4) % 32; break;
+            default: keysyms_intl[i] = XK_KP_0 + (i / 4) % 10; break;
+        }
+
+        uint16_t buffer[2] = { 0 };
+        characters_intl[i] = keysym_to_unicode(keysyms_intl[i], buffer, 2) > 0 ? buffer[0] : 0x0410;
+    }
+    #endif
+}
+
+void input_helper_benchmarks() {
+    build_mixes();
+
+    bench_distribution_header("input helper");
+
+    BENCH_DISTRIBUTION("keycode_to_scancode", keycode_to_scancode(keycodes[i]));
+    BENCH_DISTRIBUTION("scancode_to_keycode", scancode_to_keycode(scancodes[i]));
+
+    #ifdef USE_X11
+    uint16_t buffer[2];
+    BENCH_DISTRIBUTION("keysym_to_unicode (text)", keysym_to_unicode(keysyms[i], buffer, 2) + buffer[0]);
+    BENCH_DISTRIBUTION("keysym_to_unicode (intl)", keysym_to_unicode(keysyms_intl[i], buffer, 2) + buffer[0]);
+    BENCH_DISTRIBUTION("unicode_to_keysym (text)", unicode_to_keysym(characters[i]));
+    BENCH_DISTRIBUTION("unicode_to_keysym (intl)", unicode_to_keysym(characters_intl[i]));
+
+    if (helper_disp == NULL) {
+        printf("%-32s skipped, no X display\n", "keymap lookups");
+        return;
+    }
+
+    load_input_helper();
+
+    key_translation translation;
+    #ifdef USE_XKB_COMMON
+    struct xkb_context *context = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
+    struct xkb_state *state = create_xkb_state(context, XGetXCBConnection(helper_disp));
+    if (state != NULL) {
+        BENCH_DISTRIBUTION("keycode_to_unicode", keycode_to_unicode(state, keycodes[i], buffer, 2) + buffer[0]);
+        BENCH_DISTRIBUTION("keycode_to_translation", (keycode_to_translation(state, keycodes[i], &translation), translation.keysym));
+        destroy_xkb_state(state);
+    }
+    xkb_context_unref(context);
+    #else
+    BENCH_DISTRIBUTION("keycode_to_keysym", keycode_to_keysym(keycodes[i], modifiers[i]));
+    BENCH_DISTRIBUTION("keycode_to_translation", (keycode_to_translation(keycodes[i], modifiers[i], &translation), translation.keysym));
+    #endif
+
+    unload_input_helper();
+    #endif
+}
@@ -101,9 +101,45 @@ static char * test_bidirectional_scancode() {
     return NULL;
 }
 
+#ifdef USE_X11
+/* Make sure every character in the Basic Multilingual Plane maps to a keysym
+ * that produces it again */
+static char * test_bidirectional_unicode() {
+    for (uint32_t i = 0x0020; i <= 0xFFFF; i++) {
+        // Skip the surrogates and the control characters between the Latin-1 ranges.
+        if ((i >= 0x007F && i < 0x00A0) || (i >= 0xD800 && i <= 0xDFFF)) {
+            continue;
+        }
+
+        KeySym keysym = unicode_to_keysym((uint16_t) i);
+
+        uint16_t buffer[2] = { 0 };
+        size_t count = keysym_to_unicode(keysym, buffer, 2);
+        if (count != 1 || buffer[0] != i) {
+            printf("Testing unicode\t\t\t[0x%04X]\n", i);
+            printf("\tproduced keysym\t\t[0x%08lX]\n", (unsigned long) keysym);
+            printf("\treproduced unicode\t[0x%04X]\n\n", buffer[0]);
+        }
+
+        mu_assert("error, unicode to keysym failed to convert back", count == 1 && buffer[0] == i);
+    }
+
+    // Table characters must resolve to their preferred keysym, not the Unicode fallback.
+    mu_assert("error, Aogonek did not resolve to its keysym", unicode_to_keysym(0x0104) == 0x01A1);
+    mu_assert("error, intersection did not prefer the lowest keysym", unicode_to_keysym(0x2229) == 0x08DC);
+    mu_assert("error, box drawing did not prefer the lowest keysym", unicode_to_keysym(0x250C) == 0x08A2);
+    mu_assert("error, euro sign did not resolve to EuroSign", unicode_to_keysym(0x20AC) == 0x20AC);
+
+    return NULL;
+}
+#endif
+
 char * input_helper_tests() {
     mu_run_test(test_bidirectional_keycode);
     mu_run_test(test_bidirectional_scancode);
+    #ifdef USE_X11
+    mu_run_test(test_bidirectional_unicode);
+    #endif
 
     return NULL;
 }
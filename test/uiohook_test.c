@@ -18,7 +18,7 @@
 
 #include <stdio.h>
 
-#if !defined(__APPLE__) && !defined(__MACH__) && !defined(_WIN32)
+#ifdef USE_X11
 #include <X11/Xlib.h>
 #endif
 
@@ -28,14 +28,14 @@
 extern char * system_properties_tests();
 extern char * input_helper_tests();
 
-#if !defined(__APPLE__) && !defined(__MACH__) && !defined(_WIN32)
+#ifdef USE_X11
 static Display *disp;
 #endif
 
 int tests_run = 0;
 
 static char * init_tests() {
-    #if !defined(__APPLE__) && !defined(__MACH__) && !defined(_WIN32)
+    #ifdef USE_X11
     // TODO Create our own AC_DEFINE for this value.  Currently defaults to X11 platforms.
     Display *disp = XOpenDisplay(XDisplayName(NULL));
     mu_assert("error, could not open X display", disp != NULL);
@@ -49,7 +49,7 @@ static char * init_tests() {
 }
 
 static char * cleanup_tests() {
-    #if !defined(__APPLE__) && !defined(__MACH__) && !defined(_WIN32)
+    #ifdef USE_X11
     if (disp != NULL) {
         XCloseDisplay(disp);
         disp = NULL;